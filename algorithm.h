@@ -0,0 +1,735 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "utility.h"
+#include "vector.h"
+#include "thread_pool.h"
+
+
+namespace yo {
+
+
+	struct sequenced_policy {};
+
+
+	class parallel_policy {
+	public:
+		constexpr explicit parallel_policy (thread_pool* pool = nullptr,
+                                            size_t grain = 16384)            noexcept;
+
+		constexpr parallel_policy on  (thread_pool& pool)const               noexcept;
+		constexpr parallel_policy grain (size_t count)const                  noexcept;
+
+		thread_pool& executor         ()const;
+
+		size_t chunks                 (size_t count)const;
+	private:
+		thread_pool* pool;
+		size_t       GRAIN;
+	};
+
+
+	template<typename Key, typename = void>
+	struct RadixKey;
+
+
+	template<typename Key>
+	struct RadixKey<Key, typename std::enable_if<std::is_integral<Key>::value && !std::is_same<Key, bool>::value>::type> {
+		typedef typename std::make_unsigned<Key>::type bits;
+
+		static bits encode(Key key) noexcept
+		{ return std::is_signed<Key>::value ? (bits)key ^ ((bits)1 << (sizeof(bits) * 8 - 1)) : (bits)key; }
+	};
+
+
+	template<>
+	struct RadixKey<float> {
+		typedef uint32_t bits;
+
+		static bits encode(float key) noexcept
+		{ bits value = 0; std::memcpy(&value, &key, sizeof(value)); return value & 0x80000000u ? ~value : value | 0x80000000u; }
+	};
+
+
+	template<>
+	struct RadixKey<double> {
+		typedef uint64_t bits;
+
+		static bits encode(double key) noexcept
+		{ bits value = 0; std::memcpy(&value, &key, sizeof(value)); return value >> 63 ? ~value : value | ((bits)1 << 63); }
+	};
+
+
+	inline thread_pool& default_thread_pool() {
+		static thread_pool pool;
+		return pool;
+	}
+
+
+	constexpr parallel_policy::parallel_policy(thread_pool* pool, size_t grain) noexcept : pool(pool), GRAIN(grain == 0 ? 1 : grain) {}
+
+
+	constexpr parallel_policy parallel_policy::on(thread_pool& pool) const noexcept {
+		return parallel_policy(&pool, GRAIN);
+	}
+
+
+	constexpr parallel_policy parallel_policy::grain(size_t count) const noexcept {
+		return parallel_policy(pool, count);
+	}
+
+
+	inline constexpr sequenced_policy seq{};
+	inline constexpr parallel_policy  par{};
+
+
+	inline thread_pool& parallel_policy::executor() const {
+		return pool != nullptr ? *pool : default_thread_pool();
+	}
+
+
+	inline size_t parallel_policy::chunks(size_t count) const {
+		size_t wanted = count / GRAIN;
+		size_t limit = executor().size() * 4;
+		wanted = wanted < limit ? wanted : limit;
+		return wanted == 0 ? 1 : wanted;
+	}
+
+
+	template<typename Iterator, typename Body>
+	inline void parallel_chunks(const parallel_policy& policy, Iterator first, size_t count, size_t chunks, Body&& body) {
+		if (chunks <= 1) {
+			body(first, first + count, 0);
+			return;
+		}
+
+		task_group group(policy.executor());
+		size_t begin = 0;
+		for (size_t i = 0; i < chunks; ++i) {
+			size_t end = count * (i + 1) / chunks;
+			if (i + 1 == chunks) {
+				body(first + begin, first + end, i);
+			}
+			else {
+				group.run([&body, first, begin, end, i]() { body(first + begin, first + end, i); });
+			}
+			begin = end;
+		}
+		group.wait();
+	}
+
+
+	template<typename InputIterator, typename OutputIterator, typename Compare>
+	inline void merge_move(InputIterator first, InputIterator middle, InputIterator last, OutputIterator out, Compare comp) {
+		InputIterator right = middle;
+		while (first != middle && right != last) {
+			if (comp(*right, *first)) {
+				*out = std::move(*right);
+				++right;
+			}
+			else {
+				*out = std::move(*first);
+				++first;
+			}
+			++out;
+		}
+		for (; first != middle; ++first, ++out) {
+			*out = std::move(*first);
+		}
+		for (; right != last; ++right, ++out) {
+			*out = std::move(*right);
+		}
+	}
+
+
+	template<typename Iterator, typename Function>
+	inline Function for_each(Iterator first, Iterator last, Function function) {
+		for (; first != last; ++first) {
+			function(*first);
+		}
+		return function;
+	}
+
+
+	template<typename InputIterator, typename OutputIterator, typename Operation>
+	inline OutputIterator transform(InputIterator first, InputIterator last, OutputIterator out, Operation op) {
+		for (; first != last; ++first, ++out) {
+			*out = op(*first);
+		}
+		return out;
+	}
+
+
+	template<typename Iterator, typename T, typename Operation>
+	inline T reduce(Iterator first, Iterator last, T init, Operation op) {
+		for (; first != last; ++first) {
+			init = op(init, *first);
+		}
+		return init;
+	}
+
+
+	template<typename Iterator, typename T>
+	inline T reduce(Iterator first, Iterator last, T init) {
+		return yo::reduce(first, last, init, [](const T& left, const T& right) { return left + right; });
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline size_t count_if(Iterator first, Iterator last, Predicate pred) {
+		size_t count = 0;
+		for (; first != last; ++first) {
+			if (pred(*first)) {
+				++count;
+			}
+		}
+		return count;
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline Iterator partition(Iterator first, Iterator last, Predicate pred) {
+		while (first != last && pred(*first)) {
+			++first;
+		}
+		if (first == last) {
+			return first;
+		}
+
+		Iterator i = first;
+		for (++i; i != last; ++i) {
+			if (pred(*i)) {
+				yo::swap(*i, *first);
+				++first;
+			}
+		}
+		return first;
+	}
+
+
+	template<typename Iterator, typename Sorter>
+	inline void sort_buffered(Iterator first, Iterator last, Sorter sorter) {
+		typedef typename std::decay<decltype(*first)>::type T;
+
+		vector<T> buffer;
+		buffer.resize(yo::distance(first, last));
+		T* item = buffer.data();
+		for (Iterator it = first; it != last; ++it, ++item) {
+			*item = std::move(*it);
+		}
+
+		sorter(buffer.data(), buffer.data() + buffer.size());
+
+		item = buffer.data();
+		for (; first != last; ++first, ++item) {
+			*first = std::move(*item);
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void stable_sort(Iterator first, Iterator last, Compare comp) {
+		typedef typename std::decay<decltype(*first)>::type T;
+		const size_t RUN = 32;
+
+		if constexpr (!is_random_access<Iterator>::value) {
+			sort_buffered(first, last, [&comp](T* begin, T* end) { yo::stable_sort(begin, end, comp); });
+		}
+		else {
+			size_t count = last - first;
+			for (size_t lo = 0; lo < count; lo += RUN) {
+				yo::insertion_sort(first + lo, first + (lo + RUN < count ? lo + RUN : count), comp);
+			}
+			if (count <= RUN) {
+				return;
+			}
+
+			vector<T> buffer;
+			buffer.resize(count);
+			T* temp = buffer.data();
+
+			bool in_buffer = false;
+			for (size_t width = RUN; width < count; width *= 2, in_buffer = !in_buffer) {
+				for (size_t lo = 0; lo < count; lo += width * 2) {
+					size_t mid = lo + width < count ? lo + width : count;
+					size_t hi = lo + width * 2 < count ? lo + width * 2 : count;
+					if (in_buffer) {
+						merge_move(temp + lo, temp + mid, temp + hi, first + lo, comp);
+					}
+					else {
+						merge_move(first + lo, first + mid, first + hi, temp + lo, comp);
+					}
+				}
+			}
+			if (in_buffer) {
+				for (size_t i = 0; i < count; ++i) {
+					first[i] = std::move(temp[i]);
+				}
+			}
+		}
+	}
+
+
+	template<typename Iterator>
+	inline void stable_sort(Iterator first, Iterator last) {
+		yo::stable_sort(first, last, [](const auto& left, const auto& right) { return left < right; });
+	}
+
+
+	template<typename Source, typename Target, typename Key>
+	inline void radix_scatter(Source source, size_t count, Target target, size_t* offsets, size_t shift, Key key) {
+		typedef typename std::decay<decltype(key(*source))>::type K;
+		for (size_t i = 0; i < count; ++i) {
+			size_t digit = (size_t)(RadixKey<K>::encode(key(source[i])) >> shift) & 255;
+			target[offsets[digit]++] = std::move(source[i]);
+		}
+	}
+
+
+	template<typename Iterator, typename Key>
+	inline void radix_sort(Iterator first, Iterator last, Key key) {
+		typedef typename std::decay<decltype(*first)>::type T;
+		typedef typename std::decay<decltype(key(*first))>::type K;
+		typedef typename RadixKey<K>::bits Bits;
+		const size_t DIGITS = sizeof(Bits);
+
+		size_t count = last - first;
+		if (count < 64) {
+			yo::insertion_sort(first, last, [&key](const T& left, const T& right) { return RadixKey<K>::encode(key(left)) < RadixKey<K>::encode(key(right)); });
+			return;
+		}
+
+		size_t counts[DIGITS][256] = {};
+		for (size_t i = 0; i < count; ++i) {
+			Bits bits = RadixKey<K>::encode(key(first[i]));
+			for (size_t digit = 0; digit < DIGITS; ++digit) {
+				++counts[digit][(size_t)(bits >> (digit * 8)) & 255];
+			}
+		}
+
+		vector<T> buffer;
+		buffer.resize(count);
+		T* temp = buffer.data();
+
+		bool in_buffer = false;
+		Bits sample = RadixKey<K>::encode(key(first[0]));
+		for (size_t digit = 0; digit < DIGITS; ++digit) {
+			if (counts[digit][(size_t)(sample >> (digit * 8)) & 255] == count) {
+				continue;
+			}
+
+			size_t offsets[256];
+			for (size_t b = 0, sum = 0; b < 256; ++b) {
+				offsets[b] = sum;
+				sum += counts[digit][b];
+			}
+
+			if (in_buffer) {
+				radix_scatter(temp, count, first, offsets, digit * 8, key);
+			}
+			else {
+				radix_scatter(first, count, temp, offsets, digit * 8, key);
+			}
+			in_buffer = !in_buffer;
+		}
+
+		if (in_buffer) {
+			for (size_t i = 0; i < count; ++i) {
+				first[i] = std::move(temp[i]);
+			}
+		}
+	}
+
+
+	template<typename Iterator>
+	inline void radix_sort(Iterator first, Iterator last) {
+		yo::radix_sort(first, last, [](const auto& item) { return item; });
+	}
+
+
+	template<typename String>
+	inline int string_char(const String& str, size_t depth) noexcept {
+		return depth < str.size() ? (int)(unsigned char)str.data()[depth] + 1 : 0;
+	}
+
+
+	template<typename String>
+	inline bool string_less(const String& left, const String& right, size_t depth) noexcept {
+		size_t lsize = left.size();
+		size_t rsize = right.size();
+		for (; depth < lsize && depth < rsize; ++depth) {
+			unsigned char l = (unsigned char)left.data()[depth];
+			unsigned char r = (unsigned char)right.data()[depth];
+			if (l != r) {
+				return l < r;
+			}
+		}
+		return lsize < rsize;
+	}
+
+
+	template<typename Iterator>
+	inline void string_sort(Iterator first, Iterator last, size_t depth) {
+		while (last - first > 1) {
+			size_t count = last - first;
+			if (count < 16) {
+				yo::insertion_sort(first, last, [depth](const auto& left, const auto& right) { return string_less(left, right, depth); });
+				return;
+			}
+
+			int a = string_char(*first, depth);
+			int b = string_char(first[count / 2], depth);
+			int c = string_char(first[count - 1], depth);
+			if ((a < b) == (b < c)) {
+				yo::swap(*first, first[count / 2]);
+			}
+			else if ((a < c) == (c < b)) {
+				yo::swap(*first, first[count - 1]);
+			}
+
+			int pivot = string_char(*first, depth);
+			Iterator less = first;
+			Iterator greater = last;
+			for (Iterator i = first + 1; i != greater;) {
+				int ch = string_char(*i, depth);
+				if (ch < pivot) {
+					yo::swap(*less, *i);
+					++less;
+					++i;
+				}
+				else if (ch > pivot) {
+					--greater;
+					yo::swap(*i, *greater);
+				}
+				else {
+					++i;
+				}
+			}
+
+			yo::string_sort(first, less, depth);
+			yo::string_sort(greater, last, depth);
+			if (pivot == 0) {
+				return;
+			}
+			first = less;
+			last = greater;
+			++depth;
+		}
+	}
+
+
+	template<typename Iterator>
+	inline void string_sort(Iterator first, Iterator last) {
+		yo::string_sort(first, last, 0);
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void parallel_merge_sort(const parallel_policy& policy, Iterator first, Iterator last, Compare comp, bool stable) {
+		typedef typename std::decay<decltype(*first)>::type T;
+
+		size_t count = last - first;
+		size_t chunks = policy.chunks(count);
+		if (chunks <= 1) {
+			stable ? yo::stable_sort(first, last, comp) : yo::sort(first, last, comp);
+			return;
+		}
+
+		parallel_chunks(policy, first, count, chunks, [&comp, stable](Iterator begin, Iterator end, size_t) {
+			stable ? yo::stable_sort(begin, end, comp) : yo::sort(begin, end, comp);
+		});
+
+		vector<size_t> bounds;
+		for (size_t i = 0; i <= chunks; ++i) {
+			bounds.push_back(count * i / chunks);
+		}
+
+		vector<T> buffer;
+		buffer.resize(count);
+		T* temp = buffer.data();
+
+		bool in_buffer = false;
+		while (bounds.size() > 2) {
+			size_t* edge = bounds.data();
+			size_t runs = bounds.size() - 1;
+
+			task_group group(policy.executor());
+			for (size_t i = 0; i < runs; i += 2) {
+				size_t lo = edge[i];
+				size_t mid = edge[i + 1];
+				size_t hi = i + 2 <= runs ? edge[i + 2] : mid;
+				group.run([first, temp, lo, mid, hi, in_buffer, &comp]() {
+					if (in_buffer) {
+						merge_move(temp + lo, temp + mid, temp + hi, first + lo, comp);
+					}
+					else {
+						merge_move(first + lo, first + mid, first + hi, temp + lo, comp);
+					}
+				});
+			}
+			group.wait();
+
+			vector<size_t> merged;
+			for (size_t i = 0; i < runs; i += 2) {
+				merged.push_back(edge[i]);
+			}
+			merged.push_back(count);
+			bounds = std::move(merged);
+			in_buffer = !in_buffer;
+		}
+
+		if (in_buffer) {
+			parallel_chunks(policy, temp, count, chunks, [first, temp](T* begin, T* end, size_t) {
+				for (T* i = begin; i != end; ++i) {
+					first[i - temp] = std::move(*i);
+				}
+			});
+		}
+	}
+
+
+	template<typename Iterator, typename Function>
+	inline void for_each(const sequenced_policy&, Iterator first, Iterator last, Function function) {
+		yo::for_each(first, last, function);
+	}
+
+
+	template<typename Iterator, typename Function>
+	inline void for_each(const parallel_policy& policy, Iterator first, Iterator last, Function function) {
+		if constexpr (is_random_access<Iterator>::value) {
+			size_t count = last - first;
+			parallel_chunks(policy, first, count, policy.chunks(count), [&function](Iterator begin, Iterator end, size_t) {
+				yo::for_each(begin, end, function);
+			});
+		}
+		else {
+			yo::for_each(first, last, function);
+		}
+	}
+
+
+	template<typename InputIterator, typename OutputIterator, typename Operation>
+	inline OutputIterator transform(const sequenced_policy&, InputIterator first, InputIterator last, OutputIterator out, Operation op) {
+		return yo::transform(first, last, out, op);
+	}
+
+
+	template<typename InputIterator, typename OutputIterator, typename Operation>
+	inline OutputIterator transform(const parallel_policy& policy, InputIterator first, InputIterator last, OutputIterator out, Operation op) {
+		if constexpr (is_random_access<InputIterator>::value && is_random_access<OutputIterator>::value) {
+			size_t count = last - first;
+			parallel_chunks(policy, first, count, policy.chunks(count), [&op, first, out](InputIterator begin, InputIterator end, size_t) {
+				yo::transform(begin, end, out + (size_t)(begin - first), op);
+			});
+			return out + count;
+		}
+		else {
+			return yo::transform(first, last, out, op);
+		}
+	}
+
+
+	template<typename Iterator, typename T, typename Operation>
+	inline T reduce(const sequenced_policy&, Iterator first, Iterator last, T init, Operation op) {
+		return yo::reduce(first, last, init, op);
+	}
+
+
+	template<typename Iterator, typename T, typename Operation>
+	inline T reduce(const parallel_policy& policy, Iterator first, Iterator last, T init, Operation op) {
+		if constexpr (is_random_access<Iterator>::value) {
+			size_t count = last - first;
+			if (count == 0) {
+				return init;
+			}
+
+			size_t chunks = policy.chunks(count);
+			vector<T> partial;
+			partial.resize(chunks);
+			T* sums = partial.data();
+			parallel_chunks(policy, first, count, chunks, [&op, sums](Iterator begin, Iterator end, size_t index) {
+				T sum = *begin;
+				sums[index] = yo::reduce(++begin, end, sum, op);
+			});
+			return yo::reduce(sums, sums + chunks, init, op);
+		}
+		else {
+			return yo::reduce(first, last, init, op);
+		}
+	}
+
+
+	template<typename Policy, typename Iterator, typename T>
+	inline typename std::enable_if<std::is_same<Policy, sequenced_policy>::value || std::is_same<Policy, parallel_policy>::value, T>::type
+	reduce(const Policy& policy, Iterator first, Iterator last, T init) {
+		return yo::reduce(policy, first, last, init, [](const T& left, const T& right) { return left + right; });
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline size_t count_if(const sequenced_policy&, Iterator first, Iterator last, Predicate pred) {
+		return yo::count_if(first, last, pred);
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline size_t count_if(const parallel_policy& policy, Iterator first, Iterator last, Predicate pred) {
+		if constexpr (is_random_access<Iterator>::value) {
+			size_t count = last - first;
+			size_t chunks = policy.chunks(count);
+			vector<size_t> partial;
+			partial.resize(chunks);
+			size_t* counts = partial.data();
+			parallel_chunks(policy, first, count, chunks, [&pred, counts](Iterator begin, Iterator end, size_t index) {
+				counts[index] = yo::count_if(begin, end, pred);
+			});
+			return yo::reduce(counts, counts + chunks, (size_t)0);
+		}
+		else {
+			return yo::count_if(first, last, pred);
+		}
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline Iterator find_if(const sequenced_policy&, Iterator first, Iterator last, Predicate pred) {
+		return yo::find_if(first, last, pred);
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline Iterator find_if(const parallel_policy& policy, Iterator first, Iterator last, Predicate pred) {
+		if constexpr (is_random_access<Iterator>::value) {
+			size_t count = last - first;
+			std::atomic<size_t> found(count);
+			parallel_chunks(policy, first, count, policy.chunks(count), [&pred, &found, first](Iterator begin, Iterator end, size_t) {
+				size_t pos = begin - first;
+				for (; begin != end && pos < found.load(std::memory_order_relaxed); ++begin, ++pos) {
+					if (pred(*begin)) {
+						size_t best = found.load(std::memory_order_relaxed);
+						while (pos < best && !found.compare_exchange_weak(best, pos, std::memory_order_relaxed)) {}
+						return;
+					}
+				}
+			});
+			return first + found.load(std::memory_order_relaxed);
+		}
+		else {
+			return yo::find_if(first, last, pred);
+		}
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline Iterator partition(const sequenced_policy&, Iterator first, Iterator last, Predicate pred) {
+		return yo::partition(first, last, pred);
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	inline Iterator partition(const parallel_policy& policy, Iterator first, Iterator last, Predicate pred) {
+		if constexpr (is_random_access<Iterator>::value) {
+			size_t count = last - first;
+			size_t chunks = policy.chunks(count);
+			if (chunks <= 1) {
+				return yo::partition(first, last, pred);
+			}
+
+			vector<size_t> middles;
+			middles.resize(chunks);
+			size_t* middle = middles.data();
+			parallel_chunks(policy, first, count, chunks, [&pred, first, middle](Iterator begin, Iterator end, size_t index) {
+				middle[index] = yo::partition(begin, end, pred) - first;
+			});
+
+			size_t split = 0;
+			for (size_t i = 0; i < chunks; ++i) {
+				split += middle[i] - count * i / chunks;
+			}
+
+			size_t left = 0, lpos = middle[0];
+			size_t right = 0, rpos = split;
+			while (true) {
+				while (left < chunks && lpos >= (count * (left + 1) / chunks < split ? count * (left + 1) / chunks : split)) {
+					if (++left < chunks) {
+						lpos = middle[left];
+					}
+				}
+				while (right < chunks && rpos >= middle[right]) {
+					if (++right < chunks) {
+						rpos = count * right / chunks > split ? count * right / chunks : split;
+					}
+				}
+				if (left == chunks || right == chunks) {
+					break;
+				}
+				yo::swap(first[lpos++], first[rpos++]);
+			}
+			return first + split;
+		}
+		else {
+			return yo::partition(first, last, pred);
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void sort(const sequenced_policy&, Iterator first, Iterator last, Compare comp) {
+		if constexpr (is_random_access<Iterator>::value) {
+			yo::sort(first, last, comp);
+		}
+		else {
+			sort_buffered(first, last, [&comp](auto begin, auto end) { yo::sort(begin, end, comp); });
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void sort(const parallel_policy& policy, Iterator first, Iterator last, Compare comp) {
+		if constexpr (is_random_access<Iterator>::value) {
+			parallel_merge_sort(policy, first, last, comp, false);
+		}
+		else {
+			sort_buffered(first, last, [&policy, &comp](auto begin, auto end) { parallel_merge_sort(policy, begin, end, comp, false); });
+		}
+	}
+
+
+	template<typename Policy, typename Iterator>
+	inline typename std::enable_if<std::is_same<Policy, sequenced_policy>::value || std::is_same<Policy, parallel_policy>::value>::type
+	sort(const Policy& policy, Iterator first, Iterator last) {
+		yo::sort(policy, first, last, [](const auto& left, const auto& right) { return left < right; });
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void stable_sort(const sequenced_policy&, Iterator first, Iterator last, Compare comp) {
+		yo::stable_sort(first, last, comp);
+	}
+
+
+	template<typename Iterator, typename Compare>
+	inline void stable_sort(const parallel_policy& policy, Iterator first, Iterator last, Compare comp) {
+		if constexpr (is_random_access<Iterator>::value) {
+			parallel_merge_sort(policy, first, last, comp, true);
+		}
+		else {
+			sort_buffered(first, last, [&policy, &comp](auto begin, auto end) { parallel_merge_sort(policy, begin, end, comp, true); });
+		}
+	}
+
+
+	template<typename Policy, typename Iterator>
+	inline typename std::enable_if<std::is_same<Policy, sequenced_policy>::value || std::is_same<Policy, parallel_policy>::value>::type
+	stable_sort(const Policy& policy, Iterator first, Iterator last) {
+		yo::stable_sort(policy, first, last, [](const auto& left, const auto& right) { return left < right; });
+	}
+
+
+}
@@ -7,15 +7,18 @@
 
 
 #include <initializer_list>
+#include <numeric>
 
+#include "utility.h"
 #include "iterators/reverse_iterator.h"
 
 
 namespace yo {
 
 
-	template<typename T, size_t SIZE>
+	template<typename T, size_t SIZE, size_t ALIGN = alignof(T)>
 	class array {
+		static_assert((ALIGN & (ALIGN - 1)) == 0 && ALIGN >= alignof(T), "Alignment must be a power of two not less than alignof(T)");
 	public:
 		typedef T                                                              value;
 		typedef value&                                                         reference;
@@ -24,69 +27,76 @@ namespace yo {
 		typedef const value*                                                   const_iterator;
 		typedef reverse_iterator<T, const T*, const T&, const_iterator>        const_reverse_iterator;
 		typedef reverse_iterator<T, T*, T&, iterator>                          reverse_iterator;
+		typedef array<T, SIZE, ALIGN>                                          this_type;
 	public:
-		array                          ()                                      noexcept;
-		array                          (const std::initializer_list<T>& list);
-		array                          (const array<T, SIZE>& other)           noexcept;
-		array                          (const T& item)                         noexcept;
-		template<typename Container = array<T, SIZE>>
-		array                          (const Container& other);
-
-		void fill                      (const T& item)                         noexcept;
-		void reverse                   ()                                      noexcept;
-		void emplace                   (iterator pos, const T& item)           noexcept;
-		void swap                      (array<T, SIZE>& other)                 noexcept;
-		
-		iterator begin                 ()                                      noexcept;
-		const_iterator begin           ()const                                 noexcept;
-		const_iterator cbegin          ()const                                 noexcept;
-		reverse_iterator rbegin        ()                                      noexcept;
-		const_reverse_iterator rbegin  ()const                                 noexcept;
-		const_reverse_iterator crbegin ()const                                 noexcept;
-
-		iterator end                   ()                                      noexcept;
-		const_iterator end             ()const                                 noexcept;
-		const_iterator cend            ()const                                 noexcept;
-		reverse_iterator rend          ()                                      noexcept;
-		const_reverse_iterator rend    ()const                                 noexcept;
-		const_reverse_iterator crend   ()const                                 noexcept;
-
-		T* data                        ()                                      noexcept;
-		const T* data                  ()const                                 noexcept;
-
-		bool empty                     ()const                                 noexcept;
-
-		size_t size                    ()const                                 noexcept;
-		size_t max_size                ()const                                 noexcept;
-
-		reference front                ();
-		reference back                 ();
-		const_reference front          ()const;
-		const_reference back           ()const;
-
-		reference random               ();
-		const_reference random         ()const;
-
-		reference at                   (const size_t& pos);
-		const_reference at             (const size_t& pos)const;
-
-		reference operator[]           (const size_t n);
-		const_reference operator[]     (const size_t n)const;
-
-		array<T, SIZE>& operator=      (const array<T, SIZE>& other)          noexcept;
-		template<typename Container = array<T, SIZE>>
-		array<T, SIZE>& operator=      (const Container& other);
+		static const size_t ALIGNMENT = ALIGN;
+		static const size_t LANES     = ALIGN / std::gcd(ALIGN, sizeof(T));
+	public:
+		constexpr array                          ()                                      noexcept;
+		constexpr array                          (const std::initializer_list<T>& list);
+		constexpr array                          (const this_type& other)                noexcept;
+		constexpr array                          (const T& item)                         noexcept;
+		template<typename Container = this_type>
+		constexpr array                          (const Container& other);
+
+		constexpr void fill                      (const T& item)                         noexcept;
+		constexpr void reverse                   ()                                      noexcept;
+		void shuffle                             ()                                      noexcept;
+		constexpr void emplace                   (iterator pos, const T& item)           noexcept;
+		constexpr void swap                      (this_type& other)                      noexcept;
+
+		constexpr iterator begin                 ()                                      noexcept;
+		constexpr const_iterator begin           ()const                                 noexcept;
+		constexpr const_iterator cbegin          ()const                                 noexcept;
+		constexpr reverse_iterator rbegin        ()                                      noexcept;
+		constexpr const_reverse_iterator rbegin  ()const                                 noexcept;
+		constexpr const_reverse_iterator crbegin ()const                                 noexcept;
+
+		constexpr iterator end                   ()                                      noexcept;
+		constexpr const_iterator end             ()const                                 noexcept;
+		constexpr const_iterator cend            ()const                                 noexcept;
+		constexpr reverse_iterator rend          ()                                      noexcept;
+		constexpr const_reverse_iterator rend    ()const                                 noexcept;
+		constexpr const_reverse_iterator crend   ()const                                 noexcept;
+
+		constexpr T* data                        ()                                      noexcept;
+		constexpr const T* data                  ()const                                 noexcept;
+		T* data_aligned                          ()                                      noexcept;
+		const T* data_aligned                    ()const                                 noexcept;
+
+		constexpr bool empty                     ()const                                 noexcept;
+
+		constexpr size_t size                    ()const                                 noexcept;
+		constexpr size_t max_size                ()const                                 noexcept;
+
+		constexpr reference front                ();
+		constexpr reference back                 ();
+		constexpr const_reference front          ()const;
+		constexpr const_reference back           ()const;
+
+		reference random                         ();
+		const_reference random                   ()const;
+
+		constexpr reference at                   (const size_t& pos);
+		constexpr const_reference at             (const size_t& pos)const;
+
+		constexpr reference operator[]           (const size_t n);
+		constexpr const_reference operator[]     (const size_t n)const;
+
+		constexpr this_type& operator=           (const this_type& other)                noexcept;
+		template<typename Container = this_type>
+		constexpr this_type& operator=           (const Container& other);
 	protected:
-		T elems[SIZE == 0 ? 1 : SIZE];
+		alignas(ALIGN) T elems[((SIZE == 0 ? 1 : SIZE) + LANES - 1) / LANES * LANES];
 	};
 
 
-	template<typename T, size_t SIZE>
-	inline array<T, SIZE>::array() noexcept {}
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr array<T, SIZE, ALIGN>::array() noexcept : elems{} {}
 
 
-	template<typename T, size_t SIZE>
-	inline array<T, SIZE>::array(const std::initializer_list<T>& list) {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr array<T, SIZE, ALIGN>::array(const std::initializer_list<T>& list) : elems{} {
 		YO_ASSERT_THROW(list.size() > SIZE, "Out of bounds");
 		size_t index = 0;
 		for (const T& elem : list) {
@@ -95,242 +105,266 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline array<T, SIZE>::array(const array<T, SIZE>& other) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr array<T, SIZE, ALIGN>::array(const this_type& other) noexcept : elems{} {
 		*this = other;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline array<T, SIZE>::array(const T& item) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr array<T, SIZE, ALIGN>::array(const T& item) noexcept : elems{} {
 		fill(item);
 	}
 
 
-	template<typename T, size_t SIZE>
+	template<typename T, size_t SIZE, size_t ALIGN>
 	template<typename Container>
-	inline array<T, SIZE>::array(const Container& other) {
+	constexpr array<T, SIZE, ALIGN>::array(const Container& other) : elems{} {
 		YO_ASSERT_THROW(other.size() > SIZE, "Out of bounds");
 		*this = other;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline void array<T, SIZE>::fill(const T& item) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr void array<T, SIZE, ALIGN>::fill(const T& item) noexcept {
+		if (!is_constant_evaluated()) {
+			simd_fill(elems, elems + SIZE, item);
+			return;
+		}
 		for (size_t i = 0; i < SIZE; ++i) {
 			elems[i] = item;
 		}
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline void array<T, SIZE>::reverse() noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr void array<T, SIZE, ALIGN>::reverse() noexcept {
+		if (!is_constant_evaluated()) {
+			simd_reverse(elems, elems + SIZE);
+			return;
+		}
 		for (size_t i = 0, j = empty() ? SIZE : SIZE - 1; i < j; ++i, --j) {
-			T temp = elems[i];
-			elems[i] = elems[j];
-			elems[j] = temp;
+			yo::swap(elems[i], elems[j]);
 		}
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline void array<T, SIZE>::emplace(iterator it, const T& item) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	inline void array<T, SIZE, ALIGN>::shuffle() noexcept {
+		yo::shuffle(begin(), end());
+	}
+
+
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr void array<T, SIZE, ALIGN>::emplace(iterator it, const T& item) noexcept {
 		*it = item;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline void array<T, SIZE>::swap(array<T, SIZE>& other) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr void array<T, SIZE, ALIGN>::swap(this_type& other) noexcept {
 		for (size_t i = 0; i < SIZE; ++i) {
-			yo::swap(elems[i], other[i]);
+			yo::swap(elems[i], other.elems[i]);
 		}
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::iterator array<T, SIZE>::begin() noexcept {
-		return &elems[0];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::iterator array<T, SIZE, ALIGN>::begin() noexcept {
+		return elems;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_iterator array<T, SIZE>::begin() const noexcept {
-		return &elems[0];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_iterator array<T, SIZE, ALIGN>::begin() const noexcept {
+		return elems;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_iterator array<T, SIZE>::cbegin() const noexcept {
-		return &elems[0];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_iterator array<T, SIZE, ALIGN>::cbegin() const noexcept {
+		return elems;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::reverse_iterator array<T, SIZE>::rbegin() noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reverse_iterator array<T, SIZE, ALIGN>::rbegin() noexcept {
 		return end();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reverse_iterator array<T, SIZE>::rbegin() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reverse_iterator array<T, SIZE, ALIGN>::rbegin() const noexcept {
 		return cend();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reverse_iterator array<T, SIZE>::crbegin() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reverse_iterator array<T, SIZE, ALIGN>::crbegin() const noexcept {
 		return cend();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::iterator array<T, SIZE>::end() noexcept {
-		return &elems[SIZE];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::iterator array<T, SIZE, ALIGN>::end() noexcept {
+		return elems + SIZE;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_iterator array<T, SIZE>::end() const noexcept {
-		return &elems[SIZE];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_iterator array<T, SIZE, ALIGN>::end() const noexcept {
+		return elems + SIZE;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_iterator array<T, SIZE>::cend() const noexcept {
-		return &elems[SIZE];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_iterator array<T, SIZE, ALIGN>::cend() const noexcept {
+		return elems + SIZE;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::reverse_iterator array<T, SIZE>::rend() noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reverse_iterator array<T, SIZE, ALIGN>::rend() noexcept {
 		return begin();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reverse_iterator array<T, SIZE>::rend() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reverse_iterator array<T, SIZE, ALIGN>::rend() const noexcept {
 		return cbegin();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reverse_iterator array<T, SIZE>::crend() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reverse_iterator array<T, SIZE, ALIGN>::crend() const noexcept {
 		return cbegin();
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline T* array<T, SIZE>::data() noexcept {
-		return &elems[0];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr T* array<T, SIZE, ALIGN>::data() noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr const T* array<T, SIZE, ALIGN>::data() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t SIZE, size_t ALIGN>
+	inline T* array<T, SIZE, ALIGN>::data_aligned() noexcept {
+		return yo::assume_aligned<ALIGN>(elems);
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline const T* array<T, SIZE>::data() const noexcept {
-		return &elems[0];
+	template<typename T, size_t SIZE, size_t ALIGN>
+	inline const T* array<T, SIZE, ALIGN>::data_aligned() const noexcept {
+		return yo::assume_aligned<ALIGN>(static_cast<const T*>(elems));
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline bool array<T, SIZE>::empty() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr bool array<T, SIZE, ALIGN>::empty() const noexcept {
 		return SIZE == 0;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline size_t array<T, SIZE>::size() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr size_t array<T, SIZE, ALIGN>::size() const noexcept {
 		return SIZE;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline size_t array<T, SIZE>::max_size() const noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr size_t array<T, SIZE, ALIGN>::max_size() const noexcept {
 		return SIZE;
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::reference array<T, SIZE>::front() {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reference array<T, SIZE, ALIGN>::front() {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[0];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::reference array<T, SIZE>::back() {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reference array<T, SIZE, ALIGN>::back() {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[SIZE - 1];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reference array<T, SIZE>::front() const {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reference array<T, SIZE, ALIGN>::front() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[0];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reference array<T, SIZE>::back() const {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reference array<T, SIZE, ALIGN>::back() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[SIZE - 1];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::reference array<T, SIZE>::random() {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	inline typename array<T, SIZE, ALIGN>::reference array<T, SIZE, ALIGN>::random() {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[yo::random<size_t>(0, size() - 1)];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline typename array<T, SIZE>::const_reference array<T, SIZE>::random() const {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	inline typename array<T, SIZE, ALIGN>::const_reference array<T, SIZE, ALIGN>::random() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty array");
 		return elems[yo::random<size_t>(0, size() - 1)];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline  typename array<T, SIZE>::reference array<T, SIZE>::at(const size_t& pos) {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reference array<T, SIZE, ALIGN>::at(const size_t& pos) {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline  typename array<T, SIZE>::const_reference array<T, SIZE>::at(const size_t& pos) const {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reference array<T, SIZE, ALIGN>::at(const size_t& pos) const {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline  typename array<T, SIZE>::reference array<T, SIZE>::operator[](const size_t n) {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::reference array<T, SIZE, ALIGN>::operator[](const size_t n) {
 		YO_ASSERT_THROW(n >= SIZE, "Out of range");
 		return elems[n];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline  typename array<T, SIZE>::const_reference array<T, SIZE>::operator[](const size_t n) const {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::const_reference array<T, SIZE, ALIGN>::operator[](const size_t n) const {
 		YO_ASSERT_THROW(n >= SIZE, "Out of range");
 		return elems[n];
 	}
 
 
-	template<typename T, size_t SIZE>
-	inline array<T, SIZE>& array<T, SIZE>::operator=(const array<T, SIZE>& other) noexcept {
+	template<typename T, size_t SIZE, size_t ALIGN>
+	constexpr typename array<T, SIZE, ALIGN>::this_type& array<T, SIZE, ALIGN>::operator=(const this_type& other) noexcept {
 		for (size_t i = 0; i < SIZE; ++i) {
-			elems[i] = other[i];
+			elems[i] = other.elems[i];
 		}
 		return *this;
 	}
 
 
-	template<typename T, size_t SIZE>
+	template<typename T, size_t SIZE, size_t ALIGN>
 	template<typename Container>
-	inline array<T, SIZE>& array<T, SIZE>::operator=(const Container& other) {
+	constexpr typename array<T, SIZE, ALIGN>::this_type& array<T, SIZE, ALIGN>::operator=(const Container& other) {
 		YO_ASSERT_THROW(other.size() > SIZE, "Out of bounds");
 		size_t index = 0;
 		for (const auto& item : other) {
@@ -341,44 +375,44 @@ namespace yo {
 
 
 
-	template<typename T, size_t size>
-	inline bool operator==(const array<T, size>& left, const array<T, size>& right) {
-		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 0;
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator==(const array<T, size, align>& left, const array<T, size, align>& right) {
+		return yo::equal(left.begin(), left.end(), right.begin());
 	}
 
 
-	template<typename T, size_t size>
-	inline bool operator!=(const array<T, size>& left, const array<T, size>& right) {
-		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) != 0;
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator!=(const array<T, size, align>& left, const array<T, size, align>& right) {
+		return !yo::equal(left.begin(), left.end(), right.begin());
 	}
 
 
-	template<typename T, size_t size>
-	inline bool operator>(const array<T, size>& left, const array<T, size>& right) {
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator>(const array<T, size, align>& left, const array<T, size, align>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 1;
 	}
 
 
-	template<typename T, size_t size>
-	inline bool operator<(const array<T, size>& left, const array<T, size>& right) {
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator<(const array<T, size, align>& left, const array<T, size, align>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == -1;
 	}
 
 
-	template<typename T, size_t size>
-	inline bool operator>=(const array<T, size>& left, const array<T, size>& right) {
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator>=(const array<T, size, align>& left, const array<T, size, align>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) >= 0;
 	}
 
 
-	template<typename T, size_t size>
-	inline bool operator<=(const array<T, size>& left, const array<T, size>& right) {
+	template<typename T, size_t size, size_t align>
+	constexpr bool operator<=(const array<T, size, align>& left, const array<T, size, align>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) <= 0;
 	}
 
 
-	template<typename T, size_t size>
-	void swap(array<T, size>& left, array<T, size>& right) {
+	template<typename T, size_t size, size_t align>
+	constexpr void swap(array<T, size, align>& left, array<T, size, align>& right) {
 		left.swap(right);
 	}
 
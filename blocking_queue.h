@@ -0,0 +1,231 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#if !defined(__cpp_lib_atomic_wait) && defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "mpmc_queue.h"
+
+
+namespace yo {
+
+
+	inline void atomic_wait(std::atomic<uint32_t>& word, uint32_t old) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+		word.wait(old, std::memory_order_acquire);
+#elif defined(__linux__)
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+#else
+		while (word.load(std::memory_order_acquire) == old) {
+			std::this_thread::yield();
+		}
+#endif
+	}
+
+
+	inline void atomic_notify_one(std::atomic<uint32_t>& word) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+		word.notify_one();
+#elif defined(__linux__)
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+		(void)word;
+#endif
+	}
+
+
+	inline void atomic_notify_all(std::atomic<uint32_t>& word) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+		word.notify_all();
+#elif defined(__linux__)
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+		(void)word;
+#endif
+	}
+
+
+	template<typename T, typename Queue = mpmc_queue<T>>
+	class blocking_queue {
+	public:
+		typedef T                                       value;
+		typedef Queue                                   queue_type;
+		typedef blocking_queue<T, Queue>                this_type;
+	public:
+		template<typename... Args>
+		blocking_queue                (Args&&... args);
+
+		void push                     (const T& item);
+		void push                     (T&& item);
+		void pop                      (T& item);
+
+		bool try_push                 (const T& item);
+		bool try_push                 (T&& item);
+		bool try_pop                  (T& item);
+
+		size_t push_batch             (const T* items, size_t count);
+		size_t pop_batch              (T* items, size_t count);
+
+		bool empty                    ()const                                noexcept;
+
+		size_t size                   ()const                                noexcept;
+		size_t capacity               ()const                                noexcept;
+
+		blocking_queue                (const this_type& other)               = delete;
+		this_type& operator=          (const this_type& other)               = delete;
+	private:
+		static void signal            (std::atomic<uint32_t>& word,
+                                       std::atomic<uint32_t>& waiters)       noexcept;
+		static void wait              (std::atomic<uint32_t>& word,
+                                       std::atomic<uint32_t>& waiters,
+                                       uint32_t old)                         noexcept;
+	private:
+		Queue                             elems;
+		alignas(64) std::atomic<uint32_t> pushes;
+		std::atomic<uint32_t>             pop_waiters;
+		alignas(64) std::atomic<uint32_t> pops;
+		std::atomic<uint32_t>             push_waiters;
+	};
+
+
+	template<typename T, typename Queue>
+	template<typename... Args>
+	inline blocking_queue<T, Queue>::blocking_queue(Args&&... args) : elems(std::forward<Args>(args)...) {
+		pushes.store(0, std::memory_order_relaxed);
+		pop_waiters.store(0, std::memory_order_relaxed);
+		pops.store(0, std::memory_order_relaxed);
+		push_waiters.store(0, std::memory_order_relaxed);
+	}
+
+
+	template<typename T, typename Queue>
+	inline void blocking_queue<T, Queue>::push(const T& item) {
+		while (true) {
+			uint32_t old = pops.load(std::memory_order_seq_cst);
+			if (try_push(item)) {
+				return;
+			}
+			wait(pops, push_waiters, old);
+		}
+	}
+
+
+	template<typename T, typename Queue>
+	inline void blocking_queue<T, Queue>::push(T&& item) {
+		while (true) {
+			uint32_t old = pops.load(std::memory_order_seq_cst);
+			if (try_push(std::move(item))) {
+				return;
+			}
+			wait(pops, push_waiters, old);
+		}
+	}
+
+
+	template<typename T, typename Queue>
+	inline void blocking_queue<T, Queue>::pop(T& item) {
+		while (true) {
+			uint32_t old = pushes.load(std::memory_order_seq_cst);
+			if (try_pop(item)) {
+				return;
+			}
+			wait(pushes, pop_waiters, old);
+		}
+	}
+
+
+	template<typename T, typename Queue>
+	inline bool blocking_queue<T, Queue>::try_push(const T& item) {
+		if (!elems.try_push(item)) {
+			return false;
+		}
+		signal(pushes, pop_waiters);
+		return true;
+	}
+
+
+	template<typename T, typename Queue>
+	inline bool blocking_queue<T, Queue>::try_push(T&& item) {
+		if (!elems.try_push(std::move(item))) {
+			return false;
+		}
+		signal(pushes, pop_waiters);
+		return true;
+	}
+
+
+	template<typename T, typename Queue>
+	inline bool blocking_queue<T, Queue>::try_pop(T& item) {
+		if (!elems.try_pop(item)) {
+			return false;
+		}
+		signal(pops, push_waiters);
+		return true;
+	}
+
+
+	template<typename T, typename Queue>
+	inline size_t blocking_queue<T, Queue>::push_batch(const T* items, size_t count) {
+		size_t pushed = elems.push_batch(items, count);
+		if (pushed > 0) {
+			signal(pushes, pop_waiters);
+		}
+		return pushed;
+	}
+
+
+	template<typename T, typename Queue>
+	inline size_t blocking_queue<T, Queue>::pop_batch(T* items, size_t count) {
+		size_t popped = elems.pop_batch(items, count);
+		if (popped > 0) {
+			signal(pops, push_waiters);
+		}
+		return popped;
+	}
+
+
+	template<typename T, typename Queue>
+	inline bool blocking_queue<T, Queue>::empty() const noexcept {
+		return elems.empty();
+	}
+
+
+	template<typename T, typename Queue>
+	inline size_t blocking_queue<T, Queue>::size() const noexcept {
+		return elems.size();
+	}
+
+
+	template<typename T, typename Queue>
+	inline size_t blocking_queue<T, Queue>::capacity() const noexcept {
+		return elems.capacity();
+	}
+
+
+	template<typename T, typename Queue>
+	inline void blocking_queue<T, Queue>::signal(std::atomic<uint32_t>& word, std::atomic<uint32_t>& waiters) noexcept {
+		word.fetch_add(1, std::memory_order_seq_cst);
+		if (waiters.load(std::memory_order_seq_cst) != 0) {
+			atomic_notify_all(word);
+		}
+	}
+
+
+	template<typename T, typename Queue>
+	inline void blocking_queue<T, Queue>::wait(std::atomic<uint32_t>& word, std::atomic<uint32_t>& waiters, uint32_t old) noexcept {
+		waiters.fetch_add(1, std::memory_order_seq_cst);
+		atomic_wait(word, old);
+		waiters.fetch_sub(1, std::memory_order_seq_cst);
+	}
+
+
+}
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 
 #include <initializer_list>
+#include <iostream>
+#include <utility>
 
 #include "iterators/hash_iterator.h"
 #include "utility.h"
@@ -111,6 +113,8 @@ namespace yo {
 
 		size_type hasher          (size_t key)const                              noexcept;
 		size_type hasher          (const char* key)const                         noexcept;
+		template<typename K, typename = decltype(std::declval<const K&>().hash())>
+		size_type hasher          (const K& key)const                            noexcept;
 	};
 
 
@@ -263,7 +267,7 @@ namespace yo {
 		node_type** new_bucket = bucket_create(BUCKET_SIZE = maxbuckets);
 		bucket_assign(elems, new_bucket);
 
-		delete elems;
+		delete[] elems;
 		elems = new_bucket;
 	}
 
@@ -476,7 +480,7 @@ namespace yo {
 			list_free(*b);
 		}
 
-		delete temp_bucket;
+		delete[] temp_bucket;
 	}
 
 
@@ -555,6 +559,13 @@ namespace yo {
 	}
 
 
+	template<typename Key, typename Value>
+	template<typename K, typename>
+	inline typename hashtable<Key, Value>::size_type hashtable<Key, Value>::hasher(const K& key) const noexcept {
+		return hasher((size_t)key.hash());
+	}
+
+
 
 
 	template<typename Key, typename Value>
@@ -0,0 +1,314 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include "utility.h"
+#include "iterators/intrusive_list_iterator.h"
+
+
+namespace yo {
+
+
+	struct list_hook {
+		list_hook* next;
+		list_hook* prev;
+
+		list_hook() noexcept
+		{ next = prev = nullptr; }
+
+		list_hook(const list_hook&) noexcept
+		:list_hook() {}
+
+		~list_hook() noexcept
+		{ unlink(); }
+
+		list_hook& operator=(const list_hook&) noexcept
+		{ return *this; }
+
+		bool linked() const noexcept
+		{ return next != nullptr; }
+
+		void unlink() noexcept {
+			if (next != nullptr) {
+				next->prev = prev;
+				prev->next = next;
+				next = prev = nullptr;
+			}
+		}
+	};
+
+
+	template<typename T, list_hook T::*Hook>
+	class intrusive_list {
+	public:
+		typedef T                                                        value;
+		typedef T&                                                       reference;
+		typedef const T&                                                 const_reference;
+		typedef list_hook*                                               pointer_type;
+		typedef intrusive_list<T, Hook>                                  this_type;
+		typedef intrusive_list_iterator<T, list_hook, Hook, T&>          iterator;
+		typedef intrusive_list_iterator<const T, list_hook, Hook,
+                                        const T&>                        const_iterator;
+	public:
+		intrusive_list                ()                                 noexcept;
+
+		~intrusive_list               ()                                 noexcept;
+
+		void push_back                (reference item)                   noexcept;
+		void push_front               (reference item)                   noexcept;
+
+		void pop_back                 ();
+		void pop_front                ();
+		void clear                    ()                                 noexcept;
+		void swap                     (this_type& other)                 noexcept;
+
+		iterator insert               (const iterator& pos,
+                                       reference item)                   noexcept;
+		iterator erase                (const iterator& pos);
+
+		iterator iterator_to          (reference item)                   noexcept;
+		const_iterator iterator_to    (const_reference item)const        noexcept;
+
+		iterator begin                ()                                 noexcept;
+		const_iterator begin          ()const                            noexcept;
+		const_iterator cbegin         ()const                            noexcept;
+
+		iterator end                  ()                                 noexcept;
+		const_iterator end            ()const                            noexcept;
+		const_iterator cend           ()const                            noexcept;
+
+		size_t size                   ()const                            noexcept;
+
+		bool empty                    ()const                            noexcept;
+
+		reference front               ();
+		reference back                ();
+		const_reference front         ()const;
+		const_reference back          ()const;
+
+		static void unlink            (reference item)                   noexcept;
+		static bool linked            (const_reference item)             noexcept;
+
+		intrusive_list                (const this_type& other)           = delete;
+		this_type& operator=          (const this_type& other)           = delete;
+	private:
+		void link                     (pointer_type pos, reference item) noexcept;
+		void adopt                    (this_type& other)                 noexcept;
+	private:
+		list_hook sentinel;
+	};
+
+
+	template<typename T, list_hook T::*Hook>
+	inline intrusive_list<T, Hook>::intrusive_list() noexcept {
+		sentinel.next = sentinel.prev = &sentinel;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline intrusive_list<T, Hook>::~intrusive_list() noexcept {
+		clear();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::push_back(reference item) noexcept {
+		link(&sentinel, item);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::push_front(reference item) noexcept {
+		link(sentinel.next, item);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::pop_back() {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		sentinel.prev->unlink();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::pop_front() {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		sentinel.next->unlink();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::clear() noexcept {
+		while (sentinel.next != &sentinel) {
+			sentinel.next->unlink();
+		}
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::swap(this_type& other) noexcept {
+		yo::swap(sentinel.next, other.sentinel.next);
+		yo::swap(sentinel.prev, other.sentinel.prev);
+		adopt(other);
+		other.adopt(*this);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const iterator& pos, reference item) noexcept {
+		link(pos.ptr, item);
+		return &(item.*Hook);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const iterator& pos) {
+		YO_ASSERT_THROW(pos.ptr == &sentinel, "Incorrect position");
+		iterator result = pos.ptr->next;
+		pos.ptr->unlink();
+		return result;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::iterator_to(reference item) noexcept {
+		return &(item.*Hook);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::iterator_to(const_reference item) const noexcept {
+		return const_cast<pointer_type>(&(item.*Hook));
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() noexcept {
+		return sentinel.next;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::begin() const noexcept {
+		return sentinel.next;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::cbegin() const noexcept {
+		return sentinel.next;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() noexcept {
+		return &sentinel;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::end() const noexcept {
+		return const_cast<pointer_type>(&sentinel);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::cend() const noexcept {
+		return end();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline size_t intrusive_list<T, Hook>::size() const noexcept {
+		size_t length = 0;
+		for (const list_hook* hook = sentinel.next; hook != &sentinel; hook = hook->next) {
+			++length;
+		}
+		return length;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline bool intrusive_list<T, Hook>::empty() const noexcept {
+		return sentinel.next == &sentinel;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::front() {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		return *begin();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::back() {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		return *iterator(sentinel.prev);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_reference intrusive_list<T, Hook>::front() const {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		return *begin();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline typename intrusive_list<T, Hook>::const_reference intrusive_list<T, Hook>::back() const {
+		YO_ASSERT_THROW(empty(), "Empty list");
+		return *const_iterator(sentinel.prev);
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::unlink(reference item) noexcept {
+		(item.*Hook).unlink();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline bool intrusive_list<T, Hook>::linked(const_reference item) noexcept {
+		return (item.*Hook).linked();
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::link(pointer_type pos, reference item) noexcept {
+		list_hook* hook = &(item.*Hook);
+		if (hook == pos) {
+			return;
+		}
+
+		hook->unlink();
+		hook->prev = pos->prev;
+		hook->next = pos;
+		pos->prev->next = hook;
+		pos->prev = hook;
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	inline void intrusive_list<T, Hook>::adopt(this_type& other) noexcept {
+		if (sentinel.next == &other.sentinel) {
+			sentinel.next = sentinel.prev = &sentinel;
+		}
+		else {
+			sentinel.next->prev = &sentinel;
+			sentinel.prev->next = &sentinel;
+		}
+	}
+
+
+	template<typename T, list_hook T::*Hook>
+	void swap(intrusive_list<T, Hook>& left, intrusive_list<T, Hook>& right) {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
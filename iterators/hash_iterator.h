@@ -1,14 +1,21 @@
 #pragma once
 
 
+#include <cstddef>
+#include <iterator>
+
+
 namespace yo {
 
 
 	template<typename T, typename Node, typename Reference>
 	class hash_iterator {
 	public:
+		typedef std::forward_iterator_tag iterator_category;
 		typedef T value_type;
+		typedef ptrdiff_t difference_type;
 		typedef Node node_type;
+		typedef T* pointer;
 		typedef Reference reference;
 		typedef hash_iterator<T, Node, Reference> iterator;
 	public:
@@ -0,0 +1,132 @@
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace yo {
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	class intrusive_list_iterator {
+	public:
+		typedef std::bidirectional_iterator_tag                        iterator_category;
+		typedef typename std::remove_const<T>::type                    value_type;
+		typedef ptrdiff_t                                              difference_type;
+		typedef T                                                      value;
+		typedef T*                                                     pointer;
+		typedef Hook*                                                  link_pointer;
+		typedef Reference                                              reference;
+		typedef intrusive_list_iterator<T, Hook, Member, Reference>    iterator;
+	public:
+		intrusive_list_iterator ()                                     noexcept;
+		intrusive_list_iterator (const link_pointer ptr)               noexcept;
+		intrusive_list_iterator (const iterator& it)                   noexcept;
+
+		iterator& operator++    ()                                     noexcept;
+		iterator  operator++    (int)                                  noexcept;
+
+		iterator& operator--    ()                                     noexcept;
+		iterator  operator--    (int)                                  noexcept;
+
+		reference operator*     ()const                                noexcept;
+		value*    operator->    ()const                                noexcept;
+
+		bool operator==         (const iterator& it)const              noexcept;
+		bool operator!=         (const iterator& it)const              noexcept;
+
+		iterator& operator=     (const iterator& it)                   noexcept;
+
+		static value* owner     (const Hook* hook)                     noexcept;
+	public:
+		link_pointer            ptr;
+	};
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline intrusive_list_iterator<T, Hook, Member, Reference>::intrusive_list_iterator() noexcept {}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline intrusive_list_iterator<T, Hook, Member, Reference>::intrusive_list_iterator(const link_pointer ptr) noexcept {
+		this->ptr = ptr;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline intrusive_list_iterator<T, Hook, Member, Reference>::intrusive_list_iterator(const iterator& it) noexcept {
+		this->ptr = it.ptr;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::iterator& intrusive_list_iterator<T, Hook, Member, Reference>::operator++() noexcept {
+		ptr = ptr->next;
+		return *this;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::iterator intrusive_list_iterator<T, Hook, Member, Reference>::operator++(int) noexcept {
+		iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::iterator& intrusive_list_iterator<T, Hook, Member, Reference>::operator--() noexcept {
+		ptr = ptr->prev;
+		return *this;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::iterator intrusive_list_iterator<T, Hook, Member, Reference>::operator--(int) noexcept {
+		iterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::reference intrusive_list_iterator<T, Hook, Member, Reference>::operator*() const noexcept {
+		return *owner(ptr);
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::value* intrusive_list_iterator<T, Hook, Member, Reference>::operator->() const noexcept {
+		return owner(ptr);
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline bool intrusive_list_iterator<T, Hook, Member, Reference>::operator==(const iterator& it) const noexcept {
+		return ptr == it.ptr;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline bool intrusive_list_iterator<T, Hook, Member, Reference>::operator!=(const iterator& it) const noexcept {
+		return ptr != it.ptr;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::iterator& intrusive_list_iterator<T, Hook, Member, Reference>::operator=(const iterator& it) noexcept {
+		this->ptr = it.ptr;
+		return *this;
+	}
+
+
+	template<typename T, typename Hook, Hook T::*Member, typename Reference>
+	inline typename intrusive_list_iterator<T, Hook, Member, Reference>::value* intrusive_list_iterator<T, Hook, Member, Reference>::owner(const Hook* hook) noexcept {
+		const size_t offset = (size_t)&(reinterpret_cast<T*>(0x1000)->*Member) - 0x1000;
+		return reinterpret_cast<value*>((char*)hook - offset);
+	}
+
+
+}
\ No newline at end of file
@@ -1,19 +1,28 @@
 #pragma once
 
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
 namespace yo {
 
 
-	template<typename T, typename Pointer, typename Reference>
+	template<typename T, typename Pointer, typename Reference, typename Node>
 	class list_iterator {
 	public:
-		typedef T                                      value;
-		typedef Pointer                                pointer;
-		typedef Reference                              reference;
-		typedef list_iterator<T, Pointer, Reference>   iterator;
+		typedef std::bidirectional_iterator_tag              iterator_category;
+		typedef typename std::remove_const<T>::type          value_type;
+		typedef ptrdiff_t                                    difference_type;
+		typedef T                                            value;
+		typedef T*                                           pointer;
+		typedef Pointer                                      link_pointer;
+		typedef Reference                                    reference;
+		typedef list_iterator<T, Pointer, Reference, Node>   iterator;
 	public:
 		list_iterator        ()                        noexcept;
-		list_iterator        (const pointer ptr)       noexcept;
+		list_iterator        (const link_pointer ptr)  noexcept;
 		list_iterator        (const iterator& it)      noexcept;
 
 		iterator& operator++ ()                        noexcept;
@@ -30,82 +39,82 @@ namespace yo {
 
 		iterator& operator=  (const iterator& it)      noexcept;
 	public:
-		pointer              ptr;
+		link_pointer         ptr;
 	};
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline list_iterator<T, Pointer, Reference>::list_iterator() noexcept {}
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline list_iterator<T, Pointer, Reference, Node>::list_iterator() noexcept {}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline list_iterator<T, Pointer, Reference>::list_iterator(const pointer ptr) noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline list_iterator<T, Pointer, Reference, Node>::list_iterator(const link_pointer ptr) noexcept {
 		this->ptr = ptr;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline list_iterator<T, Pointer, Reference>::list_iterator(const iterator& it) noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline list_iterator<T, Pointer, Reference, Node>::list_iterator(const iterator& it) noexcept {
 		this->ptr = it.ptr;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::iterator& list_iterator<T, Pointer, Reference>::operator++() noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::iterator& list_iterator<T, Pointer, Reference, Node>::operator++() noexcept {
 		this->ptr = ptr->next;
 		return *this;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::iterator list_iterator<T, Pointer, Reference>::operator++(int) noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::iterator list_iterator<T, Pointer, Reference, Node>::operator++(int) noexcept {
 		iterator temp(*this);
 		operator++();
 		return temp;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::iterator& list_iterator<T, Pointer, Reference>::operator--() noexcept	{
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::iterator& list_iterator<T, Pointer, Reference, Node>::operator--() noexcept	{
 		ptr = ptr->prev;
 		return *this;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::iterator list_iterator<T, Pointer, Reference>::operator--(int) noexcept	{
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::iterator list_iterator<T, Pointer, Reference, Node>::operator--(int) noexcept	{
 		iterator temp(*this);
 		operator--();
 		return temp;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::reference list_iterator<T, Pointer, Reference>::operator*() const noexcept {
-		return ptr->item;
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::reference list_iterator<T, Pointer, Reference, Node>::operator*() const noexcept {
+		return static_cast<Node*>(ptr)->item;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::value* list_iterator<T, Pointer, Reference>::operator->() const noexcept	{
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::value* list_iterator<T, Pointer, Reference, Node>::operator->() const noexcept	{
 		return &this->operator*();
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline bool list_iterator<T, Pointer, Reference>::operator==(const iterator& it) const noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline bool list_iterator<T, Pointer, Reference, Node>::operator==(const iterator& it) const noexcept {
 		return ptr == it.ptr;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline bool list_iterator<T, Pointer, Reference>::operator!=(const iterator& it) const noexcept	{
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline bool list_iterator<T, Pointer, Reference, Node>::operator!=(const iterator& it) const noexcept	{
 		return ptr != it.ptr;
 	}
 
 
-	template<typename T, typename Pointer, typename Reference>
-	inline typename list_iterator<T, Pointer, Reference>::iterator& list_iterator<T, Pointer, Reference>::operator=(const iterator& it) noexcept {
+	template<typename T, typename Pointer, typename Reference, typename Node>
+	inline typename list_iterator<T, Pointer, Reference, Node>::iterator& list_iterator<T, Pointer, Reference, Node>::operator=(const iterator& it) noexcept {
 		this->ptr = it.ptr;
 		return *this;
 	}
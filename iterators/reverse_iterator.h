@@ -1,72 +1,82 @@
 #pragma once
 
 
+#include <cstddef>
+#include <iterator>
+
+
 namespace yo {
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
 	class reverse_iterator {
 	public:
+		typedef typename std::iterator_traits<Iterator>::iterator_category iterator_category;
+		typedef T                                                 value_type;
+		typedef ptrdiff_t                                         difference_type;
 		typedef T                                                 value;
 		typedef Pointer                                           pointer;
 		typedef Reference                                         reference;
 		typedef Iterator                                          iterator_value;
 		typedef reverse_iterator<T, Pointer, Reference, Iterator> iterator;
 	public:
-		reverse_iterator     ()                                   noexcept;
-		reverse_iterator     (const iterator_value& it)               noexcept;
-		reverse_iterator     (const iterator& it)                 noexcept;
+		constexpr reverse_iterator     ()                                   noexcept;
+		constexpr reverse_iterator     (const iterator_value& it)           noexcept;
+		constexpr reverse_iterator     (const iterator& it)                 noexcept;
+
+		constexpr iterator& operator++ ()                                   noexcept;
+		constexpr iterator  operator++ (int)                                noexcept;
 
-		iterator& operator++ ()                                   noexcept;
-		iterator  operator++ (int)                                noexcept;
+		constexpr iterator& operator-- ()                                   noexcept;
+		constexpr iterator  operator-- (int)                                noexcept;
 
-		iterator& operator-- ()                                   noexcept;
-		iterator  operator-- (int)                                noexcept;
+		constexpr iterator  operator+  (difference_type count)const         noexcept;
+		constexpr iterator& operator+= (difference_type count)              noexcept;
+		constexpr iterator  operator-  (difference_type count)const         noexcept;
+		constexpr iterator& operator-= (difference_type count)              noexcept;
 
-#define OVERRIDED  template<typename size_t> iterator
-		OVERRIDED  operator+  (const size_t value)const           noexcept;
-		OVERRIDED& operator+= (const size_t value)                noexcept;
-		OVERRIDED  operator-  (const size_t value)const           noexcept;
-		OVERRIDED& operator-= (const size_t value)                noexcept;
-#undef OVERRIDED
+		constexpr difference_type operator- (const iterator& it)const       noexcept;
 
-		reference operator*  ()const                              noexcept;
-		value* operator->    ()const                              noexcept;
+		constexpr iterator_value base  ()const                              noexcept;
 
-		bool operator==      (const iterator& it)const            noexcept;
-		bool operator!=      (const iterator& it)const            noexcept;
+		constexpr reference operator*  ()const                              noexcept;
+		constexpr reference operator[] (difference_type count)const         noexcept;
+		constexpr value* operator->    ()const                              noexcept;
 
-		iterator& operator=  (const iterator& it)                 noexcept;
+		constexpr bool operator==      (const iterator& it)const            noexcept;
+		constexpr bool operator!=      (const iterator& it)const            noexcept;
+		constexpr bool operator<       (const iterator& it)const            noexcept;
+		constexpr bool operator>       (const iterator& it)const            noexcept;
+		constexpr bool operator<=      (const iterator& it)const            noexcept;
+		constexpr bool operator>=      (const iterator& it)const            noexcept;
+
+		constexpr iterator& operator=  (const iterator& it)                 noexcept;
 	public:
 		iterator_value       ptr;
 	};
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator() noexcept {	}
+	constexpr yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator() noexcept : ptr() {}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator(const iterator_value& it) noexcept {
-		this->ptr = it;
-	}
+	constexpr yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator(const iterator_value& it) noexcept : ptr(it) {}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator(const iterator& it) noexcept {
-		this->ptr = it.ptr;
-	}
+	constexpr yo::reverse_iterator<T, Pointer, Reference, Iterator>::reverse_iterator(const iterator& it) noexcept : ptr(it.ptr) {}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator++() noexcept {
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator++() noexcept {
 		--ptr;
 		return *this;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator++(int) noexcept {
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator++(int) noexcept {
 		iterator temp(*this);
 		operator++();
 		return temp;
@@ -74,14 +84,14 @@ namespace yo {
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator--() noexcept {
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator--() noexcept {
 		++ptr;
 		return *this;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator--(int) noexcept {
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator--(int) noexcept {
 		iterator temp(*this);
 		operator--();
 		return temp;
@@ -89,64 +99,110 @@ namespace yo {
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	template<typename size_t>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator+(const size_t value) const noexcept {
-		return ptr - value;
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator+(difference_type count) const noexcept {
+		return iterator(ptr - count);
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	template<typename size_t>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator+=(const size_t value) noexcept {
-		ptr -= value;
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator+=(difference_type count) noexcept {
+		ptr -= count;
 		return *this;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	template<typename size_t>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator-(const size_t value) const noexcept {
-		return ptr + value;
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator reverse_iterator<T, Pointer, Reference, Iterator>::operator-(difference_type count) const noexcept {
+		return iterator(ptr + count);
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	template<typename size_t>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator-=(const size_t value) noexcept {
-		ptr += value;
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator-=(difference_type count) noexcept {
+		ptr += count;
 		return *this;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::reference reverse_iterator<T, Pointer, Reference, Iterator>::operator*() const noexcept {
-		return *ptr;
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::difference_type reverse_iterator<T, Pointer, Reference, Iterator>::operator-(const iterator& it) const noexcept {
+		return it.ptr - ptr;
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator_value reverse_iterator<T, Pointer, Reference, Iterator>::base() const noexcept {
+		return ptr;
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::reference reverse_iterator<T, Pointer, Reference, Iterator>::operator*() const noexcept {
+		iterator_value temp(ptr);
+		--temp;
+		return *temp;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::value* reverse_iterator<T, Pointer, Reference, Iterator>::operator->() const noexcept {
-		return &(*ptr);
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::reference reverse_iterator<T, Pointer, Reference, Iterator>::operator[](difference_type count) const noexcept {
+		return *(*this + count);
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline bool reverse_iterator<T, Pointer, Reference, Iterator>::operator==(const iterator& it) const noexcept {
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::value* reverse_iterator<T, Pointer, Reference, Iterator>::operator->() const noexcept {
+		return &operator*();
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator==(const iterator& it) const noexcept {
 		return ptr == it.ptr;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline bool reverse_iterator<T, Pointer, Reference, Iterator>::operator!=(const iterator& it) const noexcept {
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator!=(const iterator& it) const noexcept {
 		return ptr != it.ptr;
 	}
 
 
 	template<typename T, typename Pointer, typename Reference, typename Iterator>
-	inline typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator=(const iterator& it) noexcept {
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator<(const iterator& it) const noexcept {
+		return it.ptr < ptr;
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator>(const iterator& it) const noexcept {
+		return ptr < it.ptr;
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator<=(const iterator& it) const noexcept {
+		return !(ptr < it.ptr);
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr bool reverse_iterator<T, Pointer, Reference, Iterator>::operator>=(const iterator& it) const noexcept {
+		return !(it.ptr < ptr);
+	}
+
+
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr typename reverse_iterator<T, Pointer, Reference, Iterator>::iterator& reverse_iterator<T, Pointer, Reference, Iterator>::operator=(const iterator& it) noexcept {
 		this->ptr = it.ptr;
 		return *this;
 	}
 
 
+	template<typename T, typename Pointer, typename Reference, typename Iterator>
+	constexpr reverse_iterator<T, Pointer, Reference, Iterator> operator+(ptrdiff_t count, const reverse_iterator<T, Pointer, Reference, Iterator>& it) noexcept {
+		return it + count;
+	}
+
+
 }
@@ -0,0 +1,261 @@
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace yo {
+
+
+	template<typename T, typename Reference>
+	class ring_buffer_iterator {
+	public:
+		typedef std::random_access_iterator_tag                 iterator_category;
+		typedef T                                               value_type;
+		typedef ptrdiff_t                                       difference_type;
+		typedef T                                               value;
+		typedef T*                                              pointer;
+		typedef Reference                                       reference;
+		typedef ring_buffer_iterator<T, Reference>              iterator;
+	public:
+		ring_buffer_iterator ()                                 noexcept;
+		ring_buffer_iterator (const pointer elems, size_t mask,
+                              size_t pos)                       noexcept;
+		ring_buffer_iterator (const iterator& it)               noexcept;
+		template<typename U, typename = typename std::enable_if<!std::is_same<U, T>::value && std::is_same<const U, T>::value>::type>
+		ring_buffer_iterator (const ring_buffer_iterator<U, U&>& it) noexcept;
+
+		iterator& operator++ ()                                 noexcept;
+		iterator  operator++ (int)                              noexcept;
+
+		iterator& operator-- ()                                 noexcept;
+		iterator  operator-- (int)                              noexcept;
+
+		iterator  operator+  (size_t count)const                noexcept;
+		iterator& operator+= (size_t count)                     noexcept;
+		iterator  operator-  (size_t count)const                noexcept;
+		iterator& operator-= (size_t count)                     noexcept;
+		ptrdiff_t operator-  (const iterator& it)const          noexcept;
+
+		reference operator*  ()const                            noexcept;
+		reference operator[] (size_t count)const                noexcept;
+		value*    operator-> ()const                            noexcept;
+
+		bool operator==      (const iterator& it)const          noexcept;
+		bool operator!=      (const iterator& it)const          noexcept;
+		bool operator<       (const iterator& it)const          noexcept;
+		bool operator>       (const iterator& it)const          noexcept;
+		bool operator<=      (const iterator& it)const          noexcept;
+		bool operator>=      (const iterator& it)const          noexcept;
+
+		iterator& operator=  (const iterator& it)               noexcept;
+	public:
+		pointer              elems;
+		size_t               mask;
+		size_t               pos;
+	};
+
+
+	template<typename T, typename Reference>
+	inline ring_buffer_iterator<T, Reference>::ring_buffer_iterator() noexcept {}
+
+
+	template<typename T, typename Reference>
+	inline ring_buffer_iterator<T, Reference>::ring_buffer_iterator(const pointer elems, size_t mask, size_t pos) noexcept {
+		this->elems = elems;
+		this->mask = mask;
+		this->pos = pos;
+	}
+
+
+	template<typename T, typename Reference>
+	inline ring_buffer_iterator<T, Reference>::ring_buffer_iterator(const iterator& it) noexcept {
+		*this = it;
+	}
+
+
+	template<typename T, typename Reference>
+	template<typename U, typename>
+	inline ring_buffer_iterator<T, Reference>::ring_buffer_iterator(const ring_buffer_iterator<U, U&>& it) noexcept {
+		this->elems = it.elems;
+		this->mask = it.mask;
+		this->pos = it.pos;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator& ring_buffer_iterator<T, Reference>::operator++() noexcept {
+		++pos;
+		return *this;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator ring_buffer_iterator<T, Reference>::operator++(int) noexcept {
+		iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator& ring_buffer_iterator<T, Reference>::operator--() noexcept {
+		--pos;
+		return *this;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator ring_buffer_iterator<T, Reference>::operator--(int) noexcept {
+		iterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator ring_buffer_iterator<T, Reference>::operator+(size_t count) const noexcept {
+		return iterator(elems, mask, pos + count);
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator& ring_buffer_iterator<T, Reference>::operator+=(size_t count) noexcept {
+		pos += count;
+		return *this;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator ring_buffer_iterator<T, Reference>::operator-(size_t count) const noexcept {
+		return iterator(elems, mask, pos - count);
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator& ring_buffer_iterator<T, Reference>::operator-=(size_t count) noexcept {
+		pos -= count;
+		return *this;
+	}
+
+
+	template<typename T, typename Reference>
+	inline ptrdiff_t ring_buffer_iterator<T, Reference>::operator-(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos);
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::reference ring_buffer_iterator<T, Reference>::operator*() const noexcept {
+		return elems[pos & mask];
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::reference ring_buffer_iterator<T, Reference>::operator[](size_t count) const noexcept {
+		return elems[(pos + count) & mask];
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::value* ring_buffer_iterator<T, Reference>::operator->() const noexcept {
+		return &elems[pos & mask];
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator==(const iterator& it) const noexcept {
+		return pos == it.pos;
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator!=(const iterator& it) const noexcept {
+		return pos != it.pos;
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator<(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos) < 0;
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator>(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos) > 0;
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator<=(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos) <= 0;
+	}
+
+
+	template<typename T, typename Reference>
+	inline bool ring_buffer_iterator<T, Reference>::operator>=(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos) >= 0;
+	}
+
+
+	template<typename T, typename Reference>
+	inline typename ring_buffer_iterator<T, Reference>::iterator& ring_buffer_iterator<T, Reference>::operator=(const iterator& it) noexcept {
+		this->elems = it.elems;
+		this->mask = it.mask;
+		this->pos = it.pos;
+		return *this;
+	}
+
+
+	template<typename T, typename Reference>
+	inline ring_buffer_iterator<T, Reference> operator+(ptrdiff_t count, const ring_buffer_iterator<T, Reference>& it) noexcept {
+		return it + (size_t)count;
+	}
+
+
+	template<typename T>
+	inline bool operator==(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) == right;
+	}
+
+
+	template<typename T>
+	inline bool operator!=(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) != right;
+	}
+
+
+	template<typename T>
+	inline bool operator<(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) < right;
+	}
+
+
+	template<typename T>
+	inline bool operator>(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) > right;
+	}
+
+
+	template<typename T>
+	inline bool operator<=(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) <= right;
+	}
+
+
+	template<typename T>
+	inline bool operator>=(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) >= right;
+	}
+
+
+	template<typename T>
+	inline ptrdiff_t operator-(const ring_buffer_iterator<T, T&>& left, const ring_buffer_iterator<const T, const T&>& right) noexcept {
+		return ring_buffer_iterator<const T, const T&>(left) - right;
+	}
+
+
+}
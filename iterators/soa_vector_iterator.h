@@ -0,0 +1,340 @@
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace yo {
+
+
+	template<typename... Fields>
+	class soa_row {
+	public:
+		typedef std::tuple<typename std::remove_const<Fields>::type...>   value;
+		typedef std::tuple<Fields*...>                                     pointers;
+		typedef std::index_sequence_for<Fields...>                         indices;
+		template<size_t I>
+		using field = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+	public:
+		soa_row              (const pointers& columns, size_t pos)         noexcept;
+		soa_row              (const soa_row& other)                         noexcept;
+
+		template<size_t I>
+		field<I>& get        ()const                                        noexcept;
+
+		std::tuple<Fields&...> tie ()const                                  noexcept;
+
+		operator value       ()const;
+
+		const soa_row& operator= (const soa_row& other)const;
+		const soa_row& operator= (const value& item)const;
+	private:
+		template<size_t... I>
+		std::tuple<Fields&...> tie (std::index_sequence<I...>)const          noexcept;
+		template<typename Row, size_t... I>
+		void assign          (const Row& other, std::index_sequence<I...>)const;
+		template<size_t... I>
+		void assign_value    (const value& item, std::index_sequence<I...>)const;
+	public:
+		pointers             columns;
+		size_t               pos;
+	};
+
+
+	template<typename... Fields>
+	class soa_vector_iterator {
+	public:
+		typedef std::random_access_iterator_tag                            iterator_category;
+		typedef typename soa_row<Fields...>::value                         value_type;
+		typedef ptrdiff_t                                                  difference_type;
+		typedef soa_row<Fields...>                                         value;
+		typedef soa_row<Fields...>                                         reference;
+		typedef void                                                       pointer;
+		typedef std::tuple<Fields*...>                                     pointers;
+		typedef soa_vector_iterator<Fields...>                             iterator;
+	public:
+		soa_vector_iterator  ()                                             noexcept;
+		soa_vector_iterator  (const pointers& columns, size_t pos)          noexcept;
+		soa_vector_iterator  (const iterator& it)                           noexcept;
+		template<typename... Others, typename = typename std::enable_if<!std::is_same<std::tuple<Others...>, std::tuple<Fields...>>::value && std::is_same<std::tuple<const Others...>, std::tuple<Fields...>>::value>::type>
+		soa_vector_iterator  (const soa_vector_iterator<Others...>& it)     noexcept;
+
+		iterator& operator++ ()                                             noexcept;
+		iterator  operator++ (int)                                          noexcept;
+
+		iterator& operator-- ()                                             noexcept;
+		iterator  operator-- (int)                                          noexcept;
+
+		iterator  operator+  (size_t count)const                            noexcept;
+		iterator& operator+= (size_t count)                                 noexcept;
+		iterator  operator-  (size_t count)const                            noexcept;
+		iterator& operator-= (size_t count)                                 noexcept;
+		ptrdiff_t operator-  (const iterator& it)const                      noexcept;
+
+		reference operator*  ()const                                        noexcept;
+		reference operator[] (size_t count)const                            noexcept;
+
+		bool operator==      (const iterator& it)const                      noexcept;
+		bool operator!=      (const iterator& it)const                      noexcept;
+		bool operator<       (const iterator& it)const                      noexcept;
+		bool operator>       (const iterator& it)const                      noexcept;
+		bool operator<=      (const iterator& it)const                      noexcept;
+		bool operator>=      (const iterator& it)const                      noexcept;
+
+		iterator& operator=  (const iterator& it)                           noexcept;
+	public:
+		pointers             columns;
+		size_t               pos;
+	};
+
+
+	template<typename... Fields>
+	inline soa_row<Fields...>::soa_row(const pointers& columns, size_t pos) noexcept : columns(columns), pos(pos) {}
+
+
+	template<typename... Fields>
+	inline soa_row<Fields...>::soa_row(const soa_row& other) noexcept : columns(other.columns), pos(other.pos) {}
+
+
+	template<typename... Fields>
+	template<size_t I>
+	inline typename soa_row<Fields...>::template field<I>& soa_row<Fields...>::get() const noexcept {
+		return std::get<I>(columns)[pos];
+	}
+
+
+	template<typename... Fields>
+	inline std::tuple<Fields&...> soa_row<Fields...>::tie() const noexcept {
+		return tie(indices());
+	}
+
+
+	template<typename... Fields>
+	inline soa_row<Fields...>::operator value() const {
+		return value(tie());
+	}
+
+
+	template<typename... Fields>
+	inline const soa_row<Fields...>& soa_row<Fields...>::operator=(const soa_row& other) const {
+		assign(other, indices());
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline const soa_row<Fields...>& soa_row<Fields...>::operator=(const value& item) const {
+		assign_value(item, indices());
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	template<size_t... I>
+	inline std::tuple<Fields&...> soa_row<Fields...>::tie(std::index_sequence<I...>) const noexcept {
+		return std::tuple<Fields&...>(std::get<I>(columns)[pos]...);
+	}
+
+
+	template<typename... Fields>
+	template<typename Row, size_t... I>
+	inline void soa_row<Fields...>::assign(const Row& other, std::index_sequence<I...>) const {
+		((std::get<I>(columns)[pos] = std::get<I>(other.columns)[other.pos]), ...);
+	}
+
+
+	template<typename... Fields>
+	template<size_t... I>
+	inline void soa_row<Fields...>::assign_value(const value& item, std::index_sequence<I...>) const {
+		((std::get<I>(columns)[pos] = std::get<I>(item)), ...);
+	}
+
+
+	template<typename... Fields>
+	inline soa_vector_iterator<Fields...>::soa_vector_iterator() noexcept : columns(), pos(0) {}
+
+
+	template<typename... Fields>
+	inline soa_vector_iterator<Fields...>::soa_vector_iterator(const pointers& columns, size_t pos) noexcept : columns(columns), pos(pos) {}
+
+
+	template<typename... Fields>
+	inline soa_vector_iterator<Fields...>::soa_vector_iterator(const iterator& it) noexcept : columns(it.columns), pos(it.pos) {}
+
+
+	template<typename... Fields>
+	template<typename... Others, typename>
+	inline soa_vector_iterator<Fields...>::soa_vector_iterator(const soa_vector_iterator<Others...>& it) noexcept : columns(it.columns), pos(it.pos) {}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator& soa_vector_iterator<Fields...>::operator++() noexcept {
+		++pos;
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator soa_vector_iterator<Fields...>::operator++(int) noexcept {
+		iterator temp(*this);
+		++pos;
+		return temp;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator& soa_vector_iterator<Fields...>::operator--() noexcept {
+		--pos;
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator soa_vector_iterator<Fields...>::operator--(int) noexcept {
+		iterator temp(*this);
+		--pos;
+		return temp;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator soa_vector_iterator<Fields...>::operator+(size_t count) const noexcept {
+		return iterator(columns, pos + count);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator& soa_vector_iterator<Fields...>::operator+=(size_t count) noexcept {
+		pos += count;
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator soa_vector_iterator<Fields...>::operator-(size_t count) const noexcept {
+		return iterator(columns, pos - count);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator& soa_vector_iterator<Fields...>::operator-=(size_t count) noexcept {
+		pos -= count;
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline ptrdiff_t soa_vector_iterator<Fields...>::operator-(const iterator& it) const noexcept {
+		return (ptrdiff_t)(pos - it.pos);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::reference soa_vector_iterator<Fields...>::operator*() const noexcept {
+		return reference(columns, pos);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::reference soa_vector_iterator<Fields...>::operator[](size_t count) const noexcept {
+		return reference(columns, pos + count);
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator==(const iterator& it) const noexcept {
+		return pos == it.pos && columns == it.columns;
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator!=(const iterator& it) const noexcept {
+		return !(*this == it);
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator<(const iterator& it) const noexcept {
+		return pos < it.pos;
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator>(const iterator& it) const noexcept {
+		return pos > it.pos;
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator<=(const iterator& it) const noexcept {
+		return pos <= it.pos;
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector_iterator<Fields...>::operator>=(const iterator& it) const noexcept {
+		return pos >= it.pos;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector_iterator<Fields...>::iterator& soa_vector_iterator<Fields...>::operator=(const iterator& it) noexcept {
+		columns = it.columns;
+		pos = it.pos;
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator==(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) == right;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator!=(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) != right;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator<(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) < right;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator>(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) > right;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator<=(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) <= right;
+	}
+
+
+	template<typename... Fields>
+	inline bool operator>=(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) >= right;
+	}
+
+
+	template<typename... Fields>
+	inline ptrdiff_t operator-(const soa_vector_iterator<Fields...>& left, const soa_vector_iterator<const Fields...>& right) noexcept {
+		return soa_vector_iterator<const Fields...>(left) - right;
+	}
+
+
+	template<size_t I, typename... Fields>
+	inline typename soa_row<Fields...>::template field<I>& get(const soa_row<Fields...>& row) noexcept {
+		return row.template get<I>();
+	}
+
+
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace yo {
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	class unrolled_list_iterator {
+	public:
+		typedef std::bidirectional_iterator_tag                     iterator_category;
+		typedef typename std::remove_const<T>::type                 value_type;
+		typedef ptrdiff_t                                           difference_type;
+		typedef T                                                   value;
+		typedef T*                                                  pointer;
+		typedef Link*                                               link_pointer;
+		typedef Reference                                           reference;
+		typedef unrolled_list_iterator<T, Link, Node, Reference>    iterator;
+	public:
+		unrolled_list_iterator ()                                   noexcept;
+		unrolled_list_iterator (const link_pointer ptr, size_t index)noexcept;
+		unrolled_list_iterator (const iterator& it)                 noexcept;
+
+		iterator& operator++   ()                                   noexcept;
+		iterator  operator++   (int)                                noexcept;
+
+		iterator& operator--   ()                                   noexcept;
+		iterator  operator--   (int)                                noexcept;
+
+		reference operator*    ()const                              noexcept;
+		value*    operator->   ()const                              noexcept;
+
+		bool operator==        (const iterator& it)const            noexcept;
+		bool operator!=        (const iterator& it)const            noexcept;
+
+		iterator& operator=    (const iterator& it)                 noexcept;
+	public:
+		link_pointer           ptr;
+		size_t                 index;
+	};
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline unrolled_list_iterator<T, Link, Node, Reference>::unrolled_list_iterator() noexcept {}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline unrolled_list_iterator<T, Link, Node, Reference>::unrolled_list_iterator(const link_pointer ptr, size_t index) noexcept {
+		this->ptr = ptr;
+		this->index = index;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline unrolled_list_iterator<T, Link, Node, Reference>::unrolled_list_iterator(const iterator& it) noexcept {
+		this->ptr = it.ptr;
+		this->index = it.index;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::iterator& unrolled_list_iterator<T, Link, Node, Reference>::operator++() noexcept {
+		if (++index >= ptr->count) {
+			ptr = ptr->next;
+			index = 0;
+		}
+		return *this;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::iterator unrolled_list_iterator<T, Link, Node, Reference>::operator++(int) noexcept {
+		iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::iterator& unrolled_list_iterator<T, Link, Node, Reference>::operator--() noexcept {
+		if (index == 0) {
+			ptr = ptr->prev;
+			index = ptr->count;
+		}
+		--index;
+		return *this;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::iterator unrolled_list_iterator<T, Link, Node, Reference>::operator--(int) noexcept {
+		iterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::reference unrolled_list_iterator<T, Link, Node, Reference>::operator*() const noexcept {
+		return static_cast<Node*>(ptr)->items()[index];
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::value* unrolled_list_iterator<T, Link, Node, Reference>::operator->() const noexcept {
+		return &this->operator*();
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline bool unrolled_list_iterator<T, Link, Node, Reference>::operator==(const iterator& it) const noexcept {
+		return ptr == it.ptr && index == it.index;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline bool unrolled_list_iterator<T, Link, Node, Reference>::operator!=(const iterator& it) const noexcept {
+		return ptr != it.ptr || index != it.index;
+	}
+
+
+	template<typename T, typename Link, typename Node, typename Reference>
+	inline typename unrolled_list_iterator<T, Link, Node, Reference>::iterator& unrolled_list_iterator<T, Link, Node, Reference>::operator=(const iterator& it) noexcept {
+		this->ptr = it.ptr;
+		this->index = it.index;
+		return *this;
+	}
+
+
+}
\ No newline at end of file
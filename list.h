@@ -10,6 +10,7 @@
 #include <initializer_list>
 
 #include "utility.h"
+#include "vector.h"
 #include "iterators/list_iterator.h"
 #include "iterators/reverse_iterator.h"
 
@@ -17,17 +18,24 @@
 namespace yo {
 
 
+	struct ListLink {
+		ListLink* next;
+		ListLink* prev;
+
+		ListLink() noexcept
+		{ next = prev = nullptr; }
+	};
+
+
 	template<typename T>
-	struct ListNode {
-		ListNode* next;
-		ListNode* prev;
-		T		  item;
+	struct ListNode : ListLink {
+		T item;
 
 		ListNode() noexcept
-		{ next = prev = nullptr; }
+		:item() {}
 
 		ListNode(const T& item) noexcept
-		:ListNode() { this->item = item; }
+		:item(item) {}
 	};
 
 
@@ -37,15 +45,16 @@ namespace yo {
 		typedef T                                                             value;
 		typedef T&                                                            reference;
 		typedef const T&                                                      const_reference;
+		typedef ListLink                                                      Link;
 		typedef ListNode<value>                                               Node;
-		typedef Node*                                                         pointer_type;
-		typedef list_iterator<T, pointer_type, T&>                            iterator;
-		typedef list_iterator<const T, pointer_type, const T&>                const_iterator;
-		typedef reverse_iterator<T, pointer_type, const T&, const_iterator>   const_reverse_iterator;
-		typedef reverse_iterator<T, pointer_type, T&, iterator>               reverse_iterator;
+		typedef Link*                                                         pointer_type;
+		typedef list_iterator<T, pointer_type, T&, Node>                      iterator;
+		typedef list_iterator<const T, pointer_type, const T&, Node>          const_iterator;
+		typedef reverse_iterator<T, const T*, const T&, const_iterator>       const_reverse_iterator;
+		typedef reverse_iterator<T, T*, T&, iterator>                         reverse_iterator;
 	public:
 		list                           ()                                     noexcept;
-		list                           (const std::initializer_list<T>& list) noexcept;
+		list                           (const std::initializer_list<T>& items)noexcept;
 		list                           (size_t count, const T& item)          noexcept;
 		list                           (const T& item)                        noexcept;
 		list                           (const list<T>& other)                 noexcept;
@@ -68,6 +77,22 @@ namespace yo {
 		void clear                     ()                                     noexcept;
 		void emplace                   (iterator pos, const T& item)          noexcept;
 		void swap                      (list<value>& other)                   noexcept;
+		void shuffle                   ()                                     noexcept;
+
+		void splice                    (const iterator& pos, list<T>& other)  noexcept;
+		void splice                    (const iterator& pos, list<T>& other,
+                                        const iterator& it)                   noexcept;
+		void splice                    (const iterator& pos, list<T>& other,
+                                        const iterator& first,
+                                        const iterator& last)                 noexcept;
+
+		void merge                     (list<T>& other)                       noexcept;
+		template<typename Compare>
+		void merge                     (list<T>& other, Compare comp)         noexcept;
+
+		void sort                      ()                                     noexcept;
+		template<typename Compare>
+		void sort                      (Compare comp)                         noexcept;
 
 		iterator find                  (const T& item)                        noexcept;
 		const_iterator find            (const T& item)const                   noexcept;
@@ -92,6 +117,14 @@ namespace yo {
 		iterator erase_first           (const iterator& first, 
                                         const iterator& last, const T& item)  noexcept;
 
+		size_t remove                  (const T& item)                        noexcept;
+		template<typename Predicate>
+		size_t remove_if               (Predicate pred)                       noexcept;
+
+		size_t unique                  ()                                     noexcept;
+		template<typename Predicate>
+		size_t unique                  (Predicate pred)                       noexcept;
+
 		iterator begin                 ()                                     noexcept;
 		const_iterator begin           ()const                                noexcept;
 		const_iterator cbegin          ()const                                noexcept;
@@ -118,24 +151,36 @@ namespace yo {
 
 		reference random               ();
 		const_reference random         ()const;
+		list<T> sample                 (size_t count)const                    noexcept;
 		
 		list<T>& operator=             (const list<T>& other)                 noexcept;
 		template<typename Container = list<T>>
 		list<T>& operator=             (const Container& other)               noexcept;
 	protected:
+		Link         sentinel;
 		pointer_type pFront;
 		pointer_type pBack;
 #ifdef YO_LIST_SIZE_CACHE
 		size_t SIZE;
 #endif
 	private:
+		void insert_node               (pointer_type pos, pointer_type node)  noexcept;
+		void link                      (pointer_type pos, pointer_type first,
+                                        pointer_type last)                    noexcept;
+		void unlink                    (pointer_type first, pointer_type last)noexcept;
+		size_t destroy                 (pointer_type first, pointer_type last)noexcept;
+
+		template<typename Compare>
+		static pointer_type merge_nodes(pointer_type a, pointer_type b,
+                                        Compare& comp)                        noexcept;
 		static void tie                (pointer_type p1, pointer_type p2) noexcept;
+		static Node* as_node           (pointer_type link)                    noexcept;
 	};
 
 
 	template<typename T>
 	inline list<T>::list() noexcept {
-		pFront = pBack = new Node;
+		pFront = pBack = &sentinel;
 #ifdef YO_LIST_SIZE_CACHE
 		SIZE = 0;
 #endif
@@ -143,9 +188,9 @@ namespace yo {
 
 
 	template<typename T>
-	inline list<T>::list(const std::initializer_list<T>& list) noexcept : list() {
-		for (const auto& item : list) {
-			push_back() = item;
+	inline list<T>::list(const std::initializer_list<T>& items) noexcept : list() {
+		for (const auto& item : items) {
+			push_back(item);
 		}
 	}
 
@@ -153,7 +198,7 @@ namespace yo {
 	template<typename T>
 	inline list<T>::list(size_t count, const T& item) noexcept : list() {
 		while (count-- > 0) {
-			push_back() = item;
+			push_back(item);
 		}
 	}
 
@@ -167,7 +212,7 @@ namespace yo {
 
 	template<typename T>
 	inline list<T>::list(const T& item) noexcept : list() {
-		push_back() = item;
+		push_back(item);
 	}
 
 
@@ -179,65 +224,54 @@ namespace yo {
 
 	template<typename T>
 	inline list<T>::~list() noexcept {
-		while (pFront != pBack) {
-			pFront = pFront->next;
-			delete pFront->prev;
-		}
-		delete pBack;
+		destroy(pFront, pBack);
 	}
 
 
 	template<typename T>
 	inline void list<T>::push_back(const T& item) noexcept {
-		push_back() = item;
+		insert_node(pBack, new Node(item));
 	}
 
 
 	template<typename T>
 	inline typename list<T>::reference list<T>::push_back() noexcept {
 		push_back_uninitialized();
-		return pBack->prev->item;
+		return as_node(pBack->prev)->item;
 	}
 
 
 	template<typename T>
 	inline void list<T>::push_back_uninitialized() noexcept	{
-		tie(pBack, new Node);
-		pBack = pBack->next;
-#ifdef YO_LIST_SIZE_CACHE
-		++SIZE;
-#endif
+		insert_node(pBack, new Node);
 	}
 
 
 	template<typename T>
 	inline void list<T>::push_front(const T& item) noexcept {
-		push_front() = item;
+		insert_node(pFront, new Node(item));
 	}
 
 
 	template<typename T>
 	inline typename list<T>::reference list<T>::push_front() noexcept	{
 		push_front_uninitialized();
-		return pFront->item;
+		return as_node(pFront)->item;
 	}
 
 
 	template<typename T>
 	inline void list<T>::push_front_uninitialized() noexcept {
-		tie(new Node, pFront);
-		pFront = pFront->prev;
-#ifdef YO_LIST_SIZE_CACHE
-		++SIZE;
-#endif
+		insert_node(pFront, new Node);
 	}
 
 
 	template<typename T>
 	inline void list<T>::pop_back() {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		pBack = pBack->prev;
-		delete pBack->next;
+		pointer_type last = pBack->prev;
+		unlink(last, last);
+		delete as_node(last);
 #ifdef YO_LIST_SIZE_CACHE
 		--SIZE;
 #endif
@@ -247,8 +281,9 @@ namespace yo {
 	template<typename T>
 	inline void list<T>::pop_front() {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		pFront = pFront->next;
-		delete pFront->prev;
+		pointer_type first = pFront;
+		unlink(first, first);
+		delete as_node(first);
 #ifdef YO_LIST_SIZE_CACHE
 		--SIZE;
 #endif
@@ -265,10 +300,9 @@ namespace yo {
 
 	template<typename T>
 	inline void list<T>::clear() noexcept {
-		while (pFront != pBack) {
-			pFront = pFront->next;
-			delete pFront->prev;
-		}
+		destroy(pFront, pBack);
+		pFront = pBack;
+		pBack->prev = nullptr;
 #ifdef YO_LIST_SIZE_CACHE
 		SIZE = 0;
 #endif
@@ -284,19 +318,175 @@ namespace yo {
 	template<typename T>
 	inline void list<T>::swap(list<T>& other) noexcept {
 		yo::swap(pFront, other.pFront);
-		yo::swap(pBack, other.pBack);
+		yo::swap(pBack->prev, other.pBack->prev);
 #ifdef YO_LIST_SIZE_CACHE
 		yo::swap(SIZE, other.SIZE);
 #endif
+
+		if (pFront == other.pBack) {
+			pFront = pBack;
+		}
+		else {
+			pBack->prev->next = pBack;
+		}
+
+		if (other.pFront == pBack) {
+			other.pFront = other.pBack;
+		}
+		else {
+			other.pBack->prev->next = other.pBack;
+		}
+	}
+
+
+	template<typename T>
+	inline void list<T>::shuffle() noexcept {
+		if (pFront == pBack) {
+			return;
+		}
+
+		vector<pointer_type> nodes;
+		for (pointer_type node = pFront; node != pBack; node = node->next) {
+			nodes.push_back(node);
+		}
+		yo::shuffle(nodes.begin(), nodes.end());
+
+		pFront = nodes[0];
+		pFront->prev = nullptr;
+		for (size_t i = 1; i < nodes.size(); ++i) {
+			tie(nodes[i - 1], nodes[i]);
+		}
+		tie(nodes[nodes.size() - 1], pBack);
+	}
+
+
+	template<typename T>
+	inline void list<T>::splice(const iterator& pos, list<T>& other) noexcept {
+		splice(pos, other, other.begin(), other.end());
+	}
+
+
+	template<typename T>
+	inline void list<T>::splice(const iterator& pos, list<T>& other, const iterator& it) noexcept {
+		if (pos != it && pos.ptr != it.ptr->next) {
+			splice(pos, other, it, it.ptr->next);
+		}
+	}
+
+
+	template<typename T>
+	inline void list<T>::splice(const iterator& pos, list<T>& other, const iterator& first, const iterator& last) noexcept {
+		if (first == last) {
+			return;
+		}
+
+		pointer_type tail = last.ptr->prev;
+#ifdef YO_LIST_SIZE_CACHE
+		if (this != &other) {
+			size_t count = 0;
+			if (first.ptr == other.pFront && last.ptr == other.pBack) {
+				count = other.SIZE;
+			}
+			else {
+				for (pointer_type node = first.ptr; node != last.ptr; node = node->next) {
+					++count;
+				}
+			}
+			other.SIZE -= count;
+			SIZE += count;
+		}
+#endif
+		other.unlink(first.ptr, tail);
+		link(pos.ptr, first.ptr, tail);
+	}
+
+
+	template<typename T>
+	inline void list<T>::merge(list<T>& other) noexcept {
+		merge(other, [](const T& a, const T& b) { return a < b; });
+	}
+
+
+	template<typename T>
+	template<typename Compare>
+	inline void list<T>::merge(list<T>& other, Compare comp) noexcept {
+		if (this == &other) {
+			return;
+		}
+
+		pointer_type it = pFront;
+		while (other.pFront != other.pBack) {
+			if (it == pBack) {
+				splice(end(), other);
+				return;
+			}
+
+			if (comp(as_node(other.pFront)->item, as_node(it)->item)) {
+				pointer_type run = other.pFront->next;
+				while (run != other.pBack && comp(as_node(run)->item, as_node(it)->item)) {
+					run = run->next;
+				}
+				splice(it, other, other.begin(), run);
+			}
+			else {
+				it = it->next;
+			}
+		}
+	}
+
+
+	template<typename T>
+	inline void list<T>::sort() noexcept {
+		sort([](const T& a, const T& b) { return a < b; });
+	}
+
+
+	template<typename T>
+	template<typename Compare>
+	inline void list<T>::sort(Compare comp) noexcept {
+		if (pFront == pBack || pFront->next == pBack) {
+			return;
+		}
+
+		pointer_type bins[64] = {};
+		pointer_type node = pFront;
+		pBack->prev->next = nullptr;
+
+		while (node != nullptr) {
+			pointer_type carry = node;
+			node = node->next;
+			carry->next = nullptr;
+
+			size_t i = 0;
+			for (; bins[i] != nullptr; ++i) {
+				carry = merge_nodes(bins[i], carry, comp);
+				bins[i] = nullptr;
+			}
+			bins[i] = carry;
+		}
+
+		pointer_type result = nullptr;
+		for (auto bin : bins) {
+			if (bin != nullptr) {
+				result = merge_nodes(bin, result, comp);
+			}
+		}
+
+		pFront = result;
+		pFront->prev = nullptr;
+		while (result->next != nullptr) {
+			result->next->prev = result;
+			result = result->next;
+		}
+		tie(result, pBack);
 	}
 
 
 	template<typename T>
 	inline typename list<T>::iterator list<T>::find(const T& item) noexcept {
 		pointer_type first = pFront;
-		pBack->item = item;
 
-		while (first->item != item) {
+		while (first != pBack && !(as_node(first)->item == item)) {
 			first = first->next;
 		}
 
@@ -307,9 +497,8 @@ namespace yo {
 	template<typename T>
 	inline typename list<T>::const_iterator list<T>::find(const T& item) const noexcept {
 		pointer_type first = pFront;
-		pBack->item = item;
 
-		while (first->item != item) {
+		while (first != pBack && !(as_node(first)->item == item)) {
 			first = first->next;
 		}
 
@@ -319,16 +508,7 @@ namespace yo {
 
 	template<typename T>
 	inline typename list<T>::iterator list<T>::insert(const iterator& pos, const T& item) noexcept {
-		if (pos.ptr == pFront) {
-			push_front(item);
-		}
-		else {
-			tie(pos.ptr->prev, new Node(item));
-			tie(pos.ptr->prev->next, pos.ptr);
-#ifdef YO_LIST_SIZE_CACHE
-			++SIZE;
-#endif
-		}
+		insert_node(pos.ptr, new Node(item));
 		return pos.ptr->prev;
 	}
 
@@ -356,16 +536,11 @@ namespace yo {
 	inline typename list<T>::iterator list<T>::erase(iterator pos) {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
 		iterator result = pos.ptr->next;
-		if (pos.ptr == pFront) {
-			pop_front();
-		}
-		else {
-			tie(pos.ptr->prev, pos.ptr->next);
-			delete pos.ptr;
+		unlink(pos.ptr, pos.ptr);
+		delete as_node(pos.ptr);
 #ifdef YO_LIST_SIZE_CACHE
-			--SIZE;
+		--SIZE;
 #endif
-		}
 		return result;
 	}
 
@@ -374,8 +549,13 @@ namespace yo {
 	inline typename list<T>::iterator list<T>::erase(iterator first, const iterator& last) {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
 
-		while (first != last) {
-			first = erase(first);
+		if (first != last) {
+			unlink(first.ptr, last.ptr->prev);
+#ifdef YO_LIST_SIZE_CACHE
+			SIZE -= destroy(first.ptr, last.ptr);
+#else
+			destroy(first.ptr, last.ptr);
+#endif
 		}
 
 		return last.ptr;
@@ -391,11 +571,29 @@ namespace yo {
 	template<typename T>
 	inline typename list<T>::iterator list<T>::erase_all(const iterator& first, const iterator& last, const T& item) noexcept {
 		iterator result = last;
-		iterator i = erase_first(first, last, item);
+		pointer_type self = nullptr;
+		pointer_type node = first.ptr;
+
+		while (node != last.ptr) {
+			pointer_type next = node->next;
+			if (as_node(node)->item == item) {
+				if (&as_node(node)->item == &item) {
+					self = node;
+				}
+				else {
+					unlink(node, node);
+					delete as_node(node);
+#ifdef YO_LIST_SIZE_CACHE
+					--SIZE;
+#endif
+				}
+				result = next;
+			}
+			node = next;
+		}
 
-		while (i != last) {
-			result = i;
-			i = erase_first(i, last, item);
+		if (self != nullptr) {
+			erase(self);
 		}
 
 		return result;
@@ -420,6 +618,72 @@ namespace yo {
 	}
 
 
+	template<typename T>
+	inline size_t list<T>::remove(const T& item) noexcept {
+		size_t count = size();
+		erase_all(begin(), end(), item);
+		return count - size();
+	}
+
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t list<T>::remove_if(Predicate pred) noexcept {
+		size_t count = 0;
+		pointer_type node = pFront;
+
+		while (node != pBack) {
+			pointer_type next = node->next;
+			if (pred(as_node(node)->item)) {
+				unlink(node, node);
+				delete as_node(node);
+				++count;
+			}
+			node = next;
+		}
+
+#ifdef YO_LIST_SIZE_CACHE
+		SIZE -= count;
+#endif
+		return count;
+	}
+
+
+	template<typename T>
+	inline size_t list<T>::unique() noexcept {
+		return unique([](const T& a, const T& b) { return a == b; });
+	}
+
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t list<T>::unique(Predicate pred) noexcept {
+		if (pFront == pBack) {
+			return 0;
+		}
+
+		size_t count = 0;
+		pointer_type node = pFront;
+
+		while (node->next != pBack) {
+			pointer_type next = node->next;
+			if (pred(as_node(node)->item, as_node(next)->item)) {
+				tie(node, next->next);
+				delete as_node(next);
+				++count;
+			}
+			else {
+				node = next;
+			}
+		}
+
+#ifdef YO_LIST_SIZE_CACHE
+		SIZE -= count;
+#endif
+		return count;
+	}
+
+
 	template<typename T>
 	inline typename list<T>::iterator list<T>::begin() noexcept {
 		return pFront;
@@ -526,28 +790,28 @@ namespace yo {
 	template<typename T>
 	inline typename list<T>::reference list<T>::front() {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		return pFront->item;
+		return as_node(pFront)->item;
 	}
 
 
 	template<typename T>
 	inline typename list<T>::reference list<T>::back() {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		return pBack->prev->item;
+		return as_node(pBack->prev)->item;
 	}
 
 
 	template<typename T>
 	inline typename list<T>::const_reference list<T>::front() const {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		return pFront->item;
+		return as_node(pFront)->item;
 	}
 
 
 	template<typename T>
 	inline typename list<T>::const_reference list<T>::back() const {
 		YO_ASSERT_THROW(pFront == pBack, "Empty list");
-		return pBack->prev->item;
+		return as_node(pBack->prev)->item;
 	}
 
 
@@ -579,6 +843,32 @@ namespace yo {
 	}
 
 
+	template<typename T>
+	inline list<T> list<T>::sample(size_t count) const noexcept {
+		random_engine& engine = thread_random_engine();
+		vector<const T*> items;
+		items.resize(count < size() ? count : size());
+		size_t seen = 0;
+
+		for (const auto& item : *this) {
+			if (seen < count) {
+				items[seen++] = &item;
+				continue;
+			}
+			size_t index = (size_t)engine.bounded(++seen);
+			if (index < count) {
+				items[index] = &item;
+			}
+		}
+
+		list<T> result;
+		for (size_t i = 0; i < items.size(); ++i) {
+			result.push_back(*items[i]);
+		}
+		return result;
+	}
+
+
 	template<typename T>
 	inline list<T>& list<T>::operator=(const list<T>& other) noexcept {
 		if (this != &other) {
@@ -603,6 +893,76 @@ namespace yo {
 
 
 
+	template<typename T>
+	inline void list<T>::insert_node(pointer_type pos, pointer_type node) noexcept {
+		link(pos, node, node);
+#ifdef YO_LIST_SIZE_CACHE
+		++SIZE;
+#endif
+	}
+
+
+	template<typename T>
+	inline void list<T>::link(pointer_type pos, pointer_type first, pointer_type last) noexcept {
+		if (pos == pFront) {
+			first->prev = nullptr;
+			pFront = first;
+		}
+		else {
+			tie(pos->prev, first);
+		}
+		tie(last, pos);
+	}
+
+
+	template<typename T>
+	inline void list<T>::unlink(pointer_type first, pointer_type last) noexcept {
+		if (first == pFront) {
+			pFront = last->next;
+			pFront->prev = nullptr;
+		}
+		else {
+			tie(first->prev, last->next);
+		}
+	}
+
+
+	template<typename T>
+	inline size_t list<T>::destroy(pointer_type first, pointer_type last) noexcept {
+		size_t count = 0;
+		while (first != last) {
+			pointer_type next = first->next;
+			delete as_node(first);
+			first = next;
+			++count;
+		}
+		return count;
+	}
+
+
+	template<typename T>
+	template<typename Compare>
+	inline typename list<T>::pointer_type list<T>::merge_nodes(pointer_type a, pointer_type b, Compare& comp) noexcept {
+		pointer_type head = nullptr;
+		pointer_type* tail = &head;
+
+		while (a != nullptr && b != nullptr) {
+			if (comp(as_node(b)->item, as_node(a)->item)) {
+				*tail = b;
+				b = b->next;
+			}
+			else {
+				*tail = a;
+				a = a->next;
+			}
+			tail = &(*tail)->next;
+		}
+		*tail = a != nullptr ? a : b;
+
+		return head;
+	}
+
+
 	template<typename T>
 	inline void list<T>::tie(pointer_type p1, pointer_type p2) noexcept {
 		p1->next = p2;
@@ -610,13 +970,16 @@ namespace yo {
 	}
 
 
+	template<typename T>
+	inline typename list<T>::Node* list<T>::as_node(pointer_type link) noexcept {
+		return static_cast<Node*>(link);
+	}
+
+
 
 	template<typename T>
 	inline bool operator==(const list<T>& left, const list<T>& right) {
-		if (yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 0) {
-			return left.size() == right.size();
-		}
-		return false;
+		return left.size() == right.size() && yo::equal(left.begin(), left.end(), right.begin());
 	}
 
 
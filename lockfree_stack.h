@@ -0,0 +1,298 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "utility.h"
+#include "vector.h"
+
+
+namespace yo {
+
+
+	template<typename T>
+	struct LockfreeNode {
+		std::atomic<uint32_t> next;
+		T                     item;
+
+		LockfreeNode() noexcept
+		:next(0), item() {}
+	};
+
+
+	template<typename T>
+	class lockfree_stack {
+	public:
+		typedef T                                        value;
+		typedef T&                                       reference;
+		typedef const T&                                 const_reference;
+		typedef LockfreeNode<T>                          Node;
+		typedef lockfree_stack<T>                        this_type;
+	public:
+		lockfree_stack                ()                                noexcept;
+
+		~lockfree_stack               ()                                noexcept;
+
+		void push                     (const T& item);
+		void push                     (T&& item);
+		bool pop                      (T& item)                         noexcept;
+		size_t pop_all                (vector<T>& items)                noexcept;
+
+		void reserve                  (size_t count);
+
+		bool empty                    ()const                           noexcept;
+
+		size_t capacity               ()const                           noexcept;
+
+		lockfree_stack                (const this_type& other)          = delete;
+		this_type& operator=          (const this_type& other)          = delete;
+	private:
+		static const uint32_t npos        = (uint32_t)-1;
+		static const uint32_t first_chunk = 6;
+		static const uint32_t max_chunks  = 32 - first_chunk;
+	private:
+		uint32_t acquire              ();
+		void release                  (uint32_t first, uint32_t last)   noexcept;
+		bool grow                     ();
+
+		Node& node                    (uint32_t index)const             noexcept;
+
+		static uint32_t detach        (std::atomic<uint64_t>& top,
+                                       const this_type& owner)          noexcept;
+		static void attach            (std::atomic<uint64_t>& top,
+                                       const this_type& owner,
+                                       uint32_t first, uint32_t last)   noexcept;
+
+		static uint64_t pack          (uint32_t tag, uint32_t index)    noexcept;
+		static uint32_t index_of      (uint64_t top)                    noexcept;
+		static uint32_t tag_of        (uint64_t top)                    noexcept;
+		static uint32_t highest_bit   (uint64_t value)                  noexcept;
+	private:
+		alignas(64) std::atomic<uint64_t> head;
+		alignas(64) std::atomic<uint64_t> pool;
+		alignas(64) std::atomic<Node*>    chunks[max_chunks];
+		std::atomic<uint32_t>             CHUNKS;
+		std::mutex                        growth;
+	};
+
+
+	template<typename T>
+	inline lockfree_stack<T>::lockfree_stack() noexcept {
+		head.store(pack(0, npos), std::memory_order_relaxed);
+		pool.store(pack(0, npos), std::memory_order_relaxed);
+		for (auto& chunk : chunks) {
+			chunk.store(nullptr, std::memory_order_relaxed);
+		}
+		CHUNKS.store(0, std::memory_order_relaxed);
+	}
+
+
+	template<typename T>
+	inline lockfree_stack<T>::~lockfree_stack() noexcept {
+		for (auto& chunk : chunks) {
+			delete[] chunk.load(std::memory_order_relaxed);
+		}
+	}
+
+
+	template<typename T>
+	inline void lockfree_stack<T>::push(const T& item) {
+		uint32_t index = acquire();
+		node(index).item = item;
+		attach(head, *this, index, index);
+	}
+
+
+	template<typename T>
+	inline void lockfree_stack<T>::push(T&& item) {
+		uint32_t index = acquire();
+		node(index).item = std::move(item);
+		attach(head, *this, index, index);
+	}
+
+
+	template<typename T>
+	inline bool lockfree_stack<T>::pop(T& item) noexcept {
+		uint32_t index = detach(head, *this);
+		if (index == npos) {
+			return false;
+		}
+
+		item = std::move(node(index).item);
+		release(index, index);
+		return true;
+	}
+
+
+	template<typename T>
+	inline size_t lockfree_stack<T>::pop_all(vector<T>& items) noexcept {
+		uint64_t top = head.load(std::memory_order_relaxed);
+		while (!head.compare_exchange_weak(top, pack(tag_of(top) + 1, npos), std::memory_order_acquire, std::memory_order_relaxed));
+
+		uint32_t first = index_of(top);
+		if (first == npos) {
+			return 0;
+		}
+
+		size_t count = 0;
+		uint32_t last = first;
+		for (uint32_t index = first; index != npos; index = node(index).next.load(std::memory_order_relaxed)) {
+			items.push_back(std::move(node(index).item));
+			last = index;
+			++count;
+		}
+
+		release(first, last);
+		return count;
+	}
+
+
+	template<typename T>
+	inline void lockfree_stack<T>::reserve(size_t count) {
+		while (capacity() < count && grow());
+	}
+
+
+	template<typename T>
+	inline bool lockfree_stack<T>::empty() const noexcept {
+		return index_of(head.load(std::memory_order_acquire)) == npos;
+	}
+
+
+	template<typename T>
+	inline size_t lockfree_stack<T>::capacity() const noexcept {
+		uint32_t count = CHUNKS.load(std::memory_order_acquire);
+		return ((size_t)1 << (count + first_chunk)) - ((size_t)1 << first_chunk);
+	}
+
+
+	template<typename T>
+	inline uint32_t lockfree_stack<T>::acquire() {
+		while (true) {
+			uint32_t index = detach(pool, *this);
+			if (index != npos) {
+				return index;
+			}
+			YO_ASSERT_THROW(!grow(), "Out of bounds");
+		}
+	}
+
+
+	template<typename T>
+	inline void lockfree_stack<T>::release(uint32_t first, uint32_t last) noexcept {
+		attach(pool, *this, first, last);
+	}
+
+
+	template<typename T>
+	inline bool lockfree_stack<T>::grow() {
+		std::lock_guard<std::mutex> guard(growth);
+
+		if (index_of(pool.load(std::memory_order_acquire)) != npos) {
+			return true;
+		}
+
+		uint32_t count = CHUNKS.load(std::memory_order_relaxed);
+		if (count == max_chunks) {
+			return false;
+		}
+
+		uint32_t size = (uint32_t)1 << (count + first_chunk);
+		uint32_t first = size - ((uint32_t)1 << first_chunk);
+		Node* chunk = new Node[size];
+
+		for (uint32_t i = 0; i + 1 < size; ++i) {
+			chunk[i].next.store(first + i + 1, std::memory_order_relaxed);
+		}
+		chunks[count].store(chunk, std::memory_order_release);
+		CHUNKS.store(count + 1, std::memory_order_release);
+
+		attach(pool, *this, first, first + size - 1);
+		return true;
+	}
+
+
+	template<typename T>
+	inline typename lockfree_stack<T>::Node& lockfree_stack<T>::node(uint32_t index) const noexcept {
+		uint64_t biased = (uint64_t)index + ((uint64_t)1 << first_chunk);
+		uint32_t chunk = highest_bit(biased) - first_chunk;
+		uint64_t offset = biased - ((uint64_t)1 << (chunk + first_chunk));
+		return chunks[chunk].load(std::memory_order_acquire)[offset];
+	}
+
+
+	template<typename T>
+	inline uint32_t lockfree_stack<T>::detach(std::atomic<uint64_t>& top, const this_type& owner) noexcept {
+		uint64_t current = top.load(std::memory_order_acquire);
+		while (true) {
+			uint32_t index = index_of(current);
+			if (index == npos) {
+				return npos;
+			}
+
+			uint32_t next = owner.node(index).next.load(std::memory_order_relaxed);
+			if (top.compare_exchange_weak(current, pack(tag_of(current) + 1, next), std::memory_order_acquire, std::memory_order_acquire)) {
+				return index;
+			}
+		}
+	}
+
+
+	template<typename T>
+	inline void lockfree_stack<T>::attach(std::atomic<uint64_t>& top, const this_type& owner, uint32_t first, uint32_t last) noexcept {
+		uint64_t current = top.load(std::memory_order_relaxed);
+		do {
+			owner.node(last).next.store(index_of(current), std::memory_order_relaxed);
+		} while (!top.compare_exchange_weak(current, pack(tag_of(current) + 1, first), std::memory_order_release, std::memory_order_relaxed));
+	}
+
+
+	template<typename T>
+	inline uint64_t lockfree_stack<T>::pack(uint32_t tag, uint32_t index) noexcept {
+		return ((uint64_t)tag << 32) | index;
+	}
+
+
+	template<typename T>
+	inline uint32_t lockfree_stack<T>::index_of(uint64_t top) noexcept {
+		return (uint32_t)top;
+	}
+
+
+	template<typename T>
+	inline uint32_t lockfree_stack<T>::tag_of(uint64_t top) noexcept {
+		return (uint32_t)(top >> 32);
+	}
+
+
+	template<typename T>
+	inline uint32_t lockfree_stack<T>::highest_bit(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return index;
+#else
+		uint32_t index = 0;
+		while (value >>= 1) {
+			++index;
+		}
+		return index;
+#endif
+	}
+
+
+}
\ No newline at end of file
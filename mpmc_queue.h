@@ -0,0 +1,228 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "utility.h"
+
+
+namespace yo {
+
+
+	template<typename T>
+	struct MpmcCell {
+		std::atomic<size_t>                 sequence;
+		alignas(T) unsigned char            storage[sizeof(T)];
+
+		T* item() noexcept
+		{ return reinterpret_cast<T*>(storage); }
+	};
+
+
+	template<typename T>
+	class mpmc_queue {
+	public:
+		typedef T                                       value;
+		typedef MpmcCell<T>                             Cell;
+		typedef mpmc_queue<T>                           this_type;
+	public:
+		mpmc_queue                    (size_t capacity = 1024);
+
+		~mpmc_queue                   ()                                     noexcept;
+
+		bool try_push                 (const T& item);
+		bool try_push                 (T&& item);
+		template<typename... Args>
+		bool try_emplace              (Args&&... args);
+		bool try_pop                  (T& item);
+
+		size_t push_batch             (const T* items, size_t count);
+		size_t pop_batch              (T* items, size_t count);
+
+		bool empty                    ()const                                noexcept;
+
+		size_t size                   ()const                                noexcept;
+		size_t capacity               ()const                                noexcept;
+
+		mpmc_queue                    (const this_type& other)               = delete;
+		this_type& operator=          (const this_type& other)               = delete;
+	private:
+		Cell* claim_push              ()                                     noexcept;
+		Cell* claim_pop               ()                                     noexcept;
+	private:
+		Cell*                           cells;
+		size_t                          mask;
+		alignas(64) std::atomic<size_t> TAIL;
+		alignas(64) std::atomic<size_t> HEAD;
+		char                            padding[64 - sizeof(std::atomic<size_t>)];
+	};
+
+
+	template<typename T>
+	inline mpmc_queue<T>::mpmc_queue(size_t capacity) {
+		YO_ASSERT_THROW((capacity < 2 || (capacity & (capacity - 1)) != 0), "Capacity must be a power of two");
+
+		cells = new Cell[capacity];
+		mask = capacity - 1;
+		for (size_t i = 0; i < capacity; ++i) {
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		TAIL.store(0, std::memory_order_relaxed);
+		HEAD.store(0, std::memory_order_relaxed);
+	}
+
+
+	template<typename T>
+	inline mpmc_queue<T>::~mpmc_queue() noexcept {
+		size_t tail = TAIL.load(std::memory_order_relaxed);
+		for (size_t pos = HEAD.load(std::memory_order_relaxed); pos != tail; ++pos) {
+			cells[pos & mask].item()->~T();
+		}
+		delete[] cells;
+	}
+
+
+	template<typename T>
+	inline bool mpmc_queue<T>::try_push(const T& item) {
+		return try_emplace(item);
+	}
+
+
+	template<typename T>
+	inline bool mpmc_queue<T>::try_push(T&& item) {
+		return try_emplace(std::move(item));
+	}
+
+
+	template<typename T>
+	template<typename... Args>
+	inline bool mpmc_queue<T>::try_emplace(Args&&... args) {
+		if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+			Cell* cell = claim_push();
+			if (cell == nullptr) {
+				return false;
+			}
+
+			size_t pos = cell->sequence.load(std::memory_order_relaxed);
+			new (cell->item()) T(std::forward<Args>(args)...);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		else {
+			static_assert(std::is_nothrow_move_constructible<T>::value, "mpmc_queue needs a noexcept move constructor when construction can throw");
+			T item(std::forward<Args>(args)...);
+			return try_emplace(std::move(item));
+		}
+	}
+
+
+	template<typename T>
+	inline bool mpmc_queue<T>::try_pop(T& item) {
+		Cell* cell = claim_pop();
+		if (cell == nullptr) {
+			return false;
+		}
+
+		size_t pos = cell->sequence.load(std::memory_order_relaxed) - 1;
+		item = std::move(*cell->item());
+		cell->item()->~T();
+		cell->sequence.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	template<typename T>
+	inline size_t mpmc_queue<T>::push_batch(const T* items, size_t count) {
+		size_t pushed = 0;
+		while (pushed < count && try_push(items[pushed])) {
+			++pushed;
+		}
+		return pushed;
+	}
+
+
+	template<typename T>
+	inline size_t mpmc_queue<T>::pop_batch(T* items, size_t count) {
+		size_t popped = 0;
+		while (popped < count && try_pop(items[popped])) {
+			++popped;
+		}
+		return popped;
+	}
+
+
+	template<typename T>
+	inline bool mpmc_queue<T>::empty() const noexcept {
+		return size() == 0;
+	}
+
+
+	template<typename T>
+	inline size_t mpmc_queue<T>::size() const noexcept {
+		size_t head = HEAD.load(std::memory_order_acquire);
+		size_t tail = TAIL.load(std::memory_order_acquire);
+		return tail > head ? tail - head : 0;
+	}
+
+
+	template<typename T>
+	inline size_t mpmc_queue<T>::capacity() const noexcept {
+		return mask + 1;
+	}
+
+
+	template<typename T>
+	inline typename mpmc_queue<T>::Cell* mpmc_queue<T>::claim_push() noexcept {
+		size_t pos = TAIL.load(std::memory_order_relaxed);
+		while (true) {
+			Cell* cell = &cells[pos & mask];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+			if (diff == 0) {
+				if (TAIL.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					return cell;
+				}
+			}
+			else if (diff < 0) {
+				return nullptr;
+			}
+			else {
+				pos = TAIL.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+
+	template<typename T>
+	inline typename mpmc_queue<T>::Cell* mpmc_queue<T>::claim_pop() noexcept {
+		size_t pos = HEAD.load(std::memory_order_relaxed);
+		while (true) {
+			Cell* cell = &cells[pos & mask];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+			if (diff == 0) {
+				if (HEAD.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					return cell;
+				}
+			}
+			else if (diff < 0) {
+				return nullptr;
+			}
+			else {
+				pos = HEAD.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include "string.h"
+
+
+namespace yo {
+
+
+	inline const char* digit_pairs() noexcept {
+		static const char table[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+		return table;
+	}
+
+
+	inline size_t count_digits(uint64_t value) noexcept {
+		size_t count = 1;
+		while (true) {
+			if (value < 10)    return count;
+			if (value < 100)   return count + 1;
+			if (value < 1000)  return count + 2;
+			if (value < 10000) return count + 3;
+			value /= 10000;
+			count += 4;
+		}
+	}
+
+
+	inline void format_digits(char* last, uint64_t value) noexcept {
+		const char* pairs = digit_pairs();
+		while (value >= 100) {
+			size_t index = (size_t)(value % 100) * 2;
+			value /= 100;
+			*--last = pairs[index + 1];
+			*--last = pairs[index];
+		}
+		if (value >= 10) {
+			size_t index = (size_t)value * 2;
+			*--last = pairs[index + 1];
+			*--last = pairs[index];
+		}
+		else {
+			*--last = (char)('0' + value);
+		}
+	}
+
+
+	template<typename Int>
+	inline typename std::enable_if<std::is_integral<Int>::value>::type append_int(string& str, Int value) noexcept {
+		typedef typename std::make_unsigned<Int>::type Unsigned;
+
+		bool negative = value < 0;
+		Unsigned number = negative ? Unsigned(0) - (Unsigned)value : (Unsigned)value;
+		size_t length = count_digits(number) + (negative ? 1 : 0);
+
+		char* out = str.append_uninitialized(length);
+		if (negative) {
+			*out = '-';
+		}
+		format_digits(out + length, number);
+	}
+
+
+	inline void append_double(string& str, double value) noexcept {
+		char buffer[32];
+#if defined(__cpp_lib_to_chars)
+		std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		str.append(buffer, result.ptr - buffer);
+#else
+		int length = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+		str.append(buffer, length);
+#endif
+	}
+
+
+	template<typename Int>
+	inline typename std::enable_if<std::is_integral<Int>::value, string>::type to_string(Int value) noexcept {
+		string result;
+		append_int(result, value);
+		return result;
+	}
+
+
+	inline string to_string(double value) noexcept {
+		string result;
+		append_double(result, value);
+		return result;
+	}
+
+
+	template<typename Int>
+	inline typename std::enable_if<std::is_integral<Int>::value, const char*>::type parse_int(const char* first, const char* last, Int& value) noexcept {
+		typedef typename std::make_unsigned<Int>::type Unsigned;
+
+		const char* it = first;
+		bool negative = false;
+		if (std::is_signed<Int>::value && it != last && *it == '-') {
+			negative = true;
+			++it;
+		}
+
+		const char* digits = it;
+		Unsigned limit = negative ? (Unsigned)0 - (Unsigned)std::numeric_limits<Int>::min() : (Unsigned)std::numeric_limits<Int>::max();
+		Unsigned number = 0;
+		while (it != last && (unsigned)(*it - '0') < 10) {
+			Unsigned digit = (Unsigned)(*it - '0');
+			if (number > (limit - digit) / 10) {
+				return first;
+			}
+			number = number * 10 + digit;
+			++it;
+		}
+
+		if (it == digits) {
+			return first;
+		}
+
+		value = negative ? (Int)(Unsigned(0) - number) : (Int)number;
+		return it;
+	}
+
+
+	template<typename Int>
+	inline typename std::enable_if<std::is_integral<Int>::value, bool>::type parse_int(const string& str, Int& value) noexcept {
+		const char* last = str.data() + str.size();
+		return !str.empty() && parse_int(str.data(), last, value) == last;
+	}
+
+
+	inline const char* parse_double(const char* first, const char* last, double& value) noexcept {
+#if defined(__cpp_lib_to_chars)
+		std::from_chars_result result = std::from_chars(first, last, value);
+		return result.ec == std::errc() ? result.ptr : first;
+#else
+		char buffer[64];
+		size_t length = last - first < 63 ? last - first : 63;
+		for (size_t i = 0; i < length; ++i) {
+			buffer[i] = first[i];
+		}
+		buffer[length] = '\0';
+
+		char* end = buffer;
+		double result = std::strtod(buffer, &end);
+		if (end == buffer) {
+			return first;
+		}
+		value = result;
+		return first + (end - buffer);
+#endif
+	}
+
+
+	inline bool parse_double(const string& str, double& value) noexcept {
+		const char* last = str.data() + str.size();
+		return !str.empty() && parse_double(str.data(), last, value) == last;
+	}
+
+
+}
\ No newline at end of file
@@ -0,0 +1,471 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <functional>
+#include <utility>
+
+#include "utility.h"
+#include "vector.h"
+
+
+namespace yo {
+
+
+	template<size_t Arity, typename Iterator, typename Compare>
+	inline void heap_sift_up(Iterator first, size_t pos, Compare comp) {
+		auto item = std::move(first[pos]);
+		while (pos > 0) {
+			size_t parent = (pos - 1) / Arity;
+			if (!comp(first[parent], item)) {
+				break;
+			}
+			first[pos] = std::move(first[parent]);
+			pos = parent;
+		}
+		first[pos] = std::move(item);
+	}
+
+
+	template<size_t Arity, typename Iterator, typename Compare>
+	inline void heap_sift_down(Iterator first, size_t size, size_t pos, Compare comp) {
+		auto item = std::move(first[pos]);
+		while (true) {
+			size_t child = pos * Arity + 1;
+			if (child >= size) {
+				break;
+			}
+
+			size_t last = child + Arity < size ? child + Arity : size;
+			size_t best = child;
+			for (size_t i = child + 1; i < last; ++i) {
+				if (comp(first[best], first[i])) {
+					best = i;
+				}
+			}
+
+			if (!comp(item, first[best])) {
+				break;
+			}
+			first[pos] = std::move(first[best]);
+			pos = best;
+		}
+		first[pos] = std::move(item);
+	}
+
+
+	template<size_t Arity = 4, typename Iterator, typename Compare>
+	inline void make_heap(Iterator first, Iterator last, Compare comp) {
+		size_t size = last - first;
+		if (size < 2) {
+			return;
+		}
+		for (size_t pos = (size - 2) / Arity + 1; pos-- > 0;) {
+			heap_sift_down<Arity>(first, size, pos, comp);
+		}
+	}
+
+
+	template<size_t Arity = 4, typename Iterator, typename Compare>
+	inline void push_heap(Iterator first, Iterator last, Compare comp) {
+		if (last - first > 1) {
+			heap_sift_up<Arity>(first, last - first - 1, comp);
+		}
+	}
+
+
+	template<size_t Arity = 4, typename Iterator, typename Compare>
+	inline void pop_heap(Iterator first, Iterator last, Compare comp) {
+		size_t size = last - first;
+		if (size > 1) {
+			yo::swap(first[0], first[size - 1]);
+			heap_sift_down<Arity>(first, size - 1, 0, comp);
+		}
+	}
+
+
+	template<size_t Arity = 4, typename Iterator, typename Compare>
+	inline bool is_heap(Iterator first, Iterator last, Compare comp) {
+		size_t size = last - first;
+		for (size_t pos = 1; pos < size; ++pos) {
+			if (comp(first[(pos - 1) / Arity], first[pos])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	template<typename T, typename Compare = std::less<T>, typename Container = vector<T>, size_t Arity = 4>
+	class priority_queue {
+		static_assert(Arity >= 2, "Heap arity must be at least 2");
+	public:
+		typedef T                                                  value;
+		typedef T&                                                 reference;
+		typedef const T&                                           const_reference;
+		typedef Container                                          container_type;
+		typedef priority_queue<T, Compare, Container, Arity>       this_type;
+	public:
+		priority_queue                ()                           noexcept;
+		priority_queue                (const Compare& comp)        noexcept;
+		template<typename InputIterator>
+		priority_queue                (InputIterator first,
+                                       InputIterator last,
+                                       const Compare& comp = Compare());
+
+		void push                     (const T& item);
+		void push                     (T&& item);
+		void pop                      ();
+		bool pop                      (T& item);
+		void clear                    ()                           noexcept;
+		void swap                     (this_type& other)           noexcept;
+
+		template<typename InputIterator>
+		void heapify                  (InputIterator first,
+                                       InputIterator last);
+
+		const_reference top           ()const;
+
+		bool empty                    ()const                      noexcept;
+
+		size_t size                   ()const                      noexcept;
+
+		const Container& container    ()const                      noexcept;
+	private:
+		Container elems;
+		Compare   comp;
+	};
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline priority_queue<T, Compare, Container, Arity>::priority_queue() noexcept {}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline priority_queue<T, Compare, Container, Arity>::priority_queue(const Compare& comp) noexcept : comp(comp) {}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	template<typename InputIterator>
+	inline priority_queue<T, Compare, Container, Arity>::priority_queue(InputIterator first, InputIterator last, const Compare& comp) : comp(comp) {
+		heapify(first, last);
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline void priority_queue<T, Compare, Container, Arity>::push(const T& item) {
+		elems.push_back(item);
+		yo::push_heap<Arity>(elems.begin(), elems.end(), comp);
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline void priority_queue<T, Compare, Container, Arity>::push(T&& item) {
+		elems.push_back(std::move(item));
+		yo::push_heap<Arity>(elems.begin(), elems.end(), comp);
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline void priority_queue<T, Compare, Container, Arity>::pop() {
+		YO_ASSERT_THROW(empty(), "Empty queue");
+		yo::pop_heap<Arity>(elems.begin(), elems.end(), comp);
+		elems.pop_back();
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline bool priority_queue<T, Compare, Container, Arity>::pop(T& item) {
+		if (empty()) {
+			return false;
+		}
+		yo::pop_heap<Arity>(elems.begin(), elems.end(), comp);
+		item = std::move(elems.back());
+		elems.pop_back();
+		return true;
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline void priority_queue<T, Compare, Container, Arity>::clear() noexcept {
+		elems.clear();
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline void priority_queue<T, Compare, Container, Arity>::swap(this_type& other) noexcept {
+		elems.swap(other.elems);
+		yo::swap(comp, other.comp);
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	template<typename InputIterator>
+	inline void priority_queue<T, Compare, Container, Arity>::heapify(InputIterator first, InputIterator last) {
+		while (first != last) {
+			elems.push_back(*first++);
+		}
+		yo::make_heap<Arity>(elems.begin(), elems.end(), comp);
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline typename priority_queue<T, Compare, Container, Arity>::const_reference priority_queue<T, Compare, Container, Arity>::top() const {
+		YO_ASSERT_THROW(empty(), "Empty queue");
+		return elems.front();
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline bool priority_queue<T, Compare, Container, Arity>::empty() const noexcept {
+		return elems.empty();
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline size_t priority_queue<T, Compare, Container, Arity>::size() const noexcept {
+		return elems.size();
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	inline const Container& priority_queue<T, Compare, Container, Arity>::container() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
+	class indexed_priority_queue {
+		static_assert(Arity >= 2, "Heap arity must be at least 2");
+	public:
+		typedef T                                                  value;
+		typedef const T&                                           const_reference;
+		typedef indexed_priority_queue<T, Compare, Arity>          this_type;
+	public:
+		indexed_priority_queue        ()                           noexcept;
+		indexed_priority_queue        (const Compare& comp)        noexcept;
+
+		void push                     (size_t id, const T& item);
+		void update                   (size_t id, const T& item);
+		void erase                    (size_t id);
+		void pop                      ();
+		void clear                    ()                           noexcept;
+
+		size_t top_id                 ()const;
+		const_reference top           ()const;
+		const_reference at            (size_t id)const;
+
+		bool contains                 (size_t id)const             noexcept;
+		bool empty                    ()const                      noexcept;
+
+		size_t size                   ()const                      noexcept;
+	public:
+		static const size_t npos = (size_t)-1;
+	private:
+		void place                    (size_t pos, size_t id)      noexcept;
+		void sift_up                  (size_t pos)                 noexcept;
+		void sift_down                (size_t pos)                 noexcept;
+		bool before                   (size_t left, size_t right)  const;
+		void remove_at                (size_t pos);
+	private:
+		vector<size_t> heap;
+		vector<size_t> positions;
+		vector<T>      keys;
+		Compare        comp;
+	};
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue() noexcept {}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue(const Compare& comp) noexcept : comp(comp) {}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::push(size_t id, const T& item) {
+		YO_ASSERT_THROW(contains(id), "Id already queued");
+
+		if (id >= positions.size()) {
+			size_t old = positions.size();
+			size_t grown = id + 1 > old * 2 ? id + 1 : old * 2;
+			positions.resize(grown);
+			keys.resize(grown);
+			for (size_t* pos = positions.data() + old; pos != positions.data() + grown; ++pos) {
+				*pos = npos;
+			}
+		}
+
+		keys.data()[id] = item;
+		heap.push_back(id);
+		positions.data()[id] = heap.size() - 1;
+		sift_up(heap.size() - 1);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::update(size_t id, const T& item) {
+		YO_ASSERT_THROW(!contains(id), "Id not queued");
+
+		bool raised = comp(keys.data()[id], item);
+		keys.data()[id] = item;
+		if (raised) {
+			sift_up(positions.data()[id]);
+		}
+		else {
+			sift_down(positions.data()[id]);
+		}
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::erase(size_t id) {
+		YO_ASSERT_THROW(!contains(id), "Id not queued");
+		remove_at(positions.data()[id]);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::pop() {
+		YO_ASSERT_THROW(empty(), "Empty queue");
+		remove_at(0);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::clear() noexcept {
+		for (size_t i = 0; i < heap.size(); ++i) {
+			positions.data()[heap.data()[i]] = npos;
+		}
+		heap.clear();
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline size_t indexed_priority_queue<T, Compare, Arity>::top_id() const {
+		YO_ASSERT_THROW(empty(), "Empty queue");
+		return heap.front();
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline typename indexed_priority_queue<T, Compare, Arity>::const_reference indexed_priority_queue<T, Compare, Arity>::top() const {
+		YO_ASSERT_THROW(empty(), "Empty queue");
+		return keys.data()[heap.front()];
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline typename indexed_priority_queue<T, Compare, Arity>::const_reference indexed_priority_queue<T, Compare, Arity>::at(size_t id) const {
+		YO_ASSERT_THROW(!contains(id), "Id not queued");
+		return keys.data()[id];
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline bool indexed_priority_queue<T, Compare, Arity>::contains(size_t id) const noexcept {
+		return id < positions.size() && positions.data()[id] != npos;
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline bool indexed_priority_queue<T, Compare, Arity>::empty() const noexcept {
+		return heap.empty();
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline size_t indexed_priority_queue<T, Compare, Arity>::size() const noexcept {
+		return heap.size();
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::place(size_t pos, size_t id) noexcept {
+		heap.data()[pos] = id;
+		positions.data()[id] = pos;
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::sift_up(size_t pos) noexcept {
+		size_t id = heap.data()[pos];
+		while (pos > 0) {
+			size_t parent = (pos - 1) / Arity;
+			if (!before(heap.data()[parent], id)) {
+				break;
+			}
+			place(pos, heap.data()[parent]);
+			pos = parent;
+		}
+		place(pos, id);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::sift_down(size_t pos) noexcept {
+		size_t size = heap.size();
+		size_t id = heap.data()[pos];
+		while (true) {
+			size_t child = pos * Arity + 1;
+			if (child >= size) {
+				break;
+			}
+
+			size_t last = child + Arity < size ? child + Arity : size;
+			size_t best = child;
+			for (size_t i = child + 1; i < last; ++i) {
+				if (before(heap.data()[best], heap.data()[i])) {
+					best = i;
+				}
+			}
+
+			if (!before(id, heap.data()[best])) {
+				break;
+			}
+			place(pos, heap.data()[best]);
+			pos = best;
+		}
+		place(pos, id);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline bool indexed_priority_queue<T, Compare, Arity>::before(size_t left, size_t right) const {
+		return comp(keys.data()[left], keys.data()[right]);
+	}
+
+
+	template<typename T, typename Compare, size_t Arity>
+	inline void indexed_priority_queue<T, Compare, Arity>::remove_at(size_t pos) {
+		size_t id = heap.data()[pos];
+		size_t last = heap.size() - 1;
+
+		positions.data()[id] = npos;
+		if (pos != last) {
+			place(pos, heap.data()[last]);
+		}
+		heap.pop_back();
+
+		if (pos < heap.size()) {
+			size_t moved = heap.data()[pos];
+			sift_up(pos);
+			if (positions.data()[moved] == pos) {
+				sift_down(pos);
+			}
+		}
+	}
+
+
+	template<typename T, typename Compare, typename Container, size_t Arity>
+	void swap(priority_queue<T, Compare, Container, Arity>& left, priority_queue<T, Compare, Container, Arity>& right) noexcept {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
@@ -2,28 +2,41 @@
 
 #ifndef YO_ASSERT_THROW
 #define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
-#endif 
+#endif
 
-#include "list.h"
+#include <utility>
+
+#include "ring_buffer.h"
 
 
 namespace yo {
 
 
-	template<typename T, class Container = yo::list<T>>
+	template<typename T, class Container = yo::ring_buffer<T>>
 	class queue {
 	public:
-		queue       ()              noexcept;
+		typedef T&                 reference;
+		typedef const T&           const_reference;
+		typedef Container          container_type;
+	public:
+		queue                 ()                                 noexcept;
 
-		void push   (const T& item) noexcept;
-		void pop    ();
+		void push             (const T& item);
+		void push             (T&& item);
+		template<typename... Args>
+		reference emplace     (Args&&... args);
+		void pop              ();
+		void clear            ()                                 noexcept;
+		void swap             (queue<T, Container>& other)       noexcept;
 
-		T front     ()const;
-		T back      ()const;
+		reference front       ();
+		reference back        ();
+		const_reference front ()const;
+		const_reference back  ()const;
 
-		bool empty  ()const         noexcept;
+		bool empty            ()const                            noexcept;
 
-		size_t size ()const         noexcept;
+		size_t size           ()const                            noexcept;
 	private:
 		Container data;
 	};
@@ -34,11 +47,24 @@ namespace yo {
 
 
 	template<typename T, class Container>
-	inline void queue<T, Container>::push(const T& item) noexcept {
+	inline void queue<T, Container>::push(const T& item) {
 		data.push_back(item);
 	}
 
 
+	template<typename T, class Container>
+	inline void queue<T, Container>::push(T&& item) {
+		data.push_back(std::move(item));
+	}
+
+
+	template<typename T, class Container>
+	template<typename... Args>
+	inline typename queue<T, Container>::reference queue<T, Container>::emplace(Args&&... args) {
+		return data.emplace_back(std::forward<Args>(args)...);
+	}
+
+
 	template<typename T, class Container>
 	inline void queue<T, Container>::pop() {
 		YO_ASSERT_THROW(data.empty(), "Empty queue");
@@ -47,14 +73,40 @@ namespace yo {
 
 
 	template<typename T, class Container>
-	inline T queue<T, Container>::front() const {
+	inline void queue<T, Container>::clear() noexcept {
+		data.clear();
+	}
+
+
+	template<typename T, class Container>
+	inline void queue<T, Container>::swap(queue<T, Container>& other) noexcept {
+		data.swap(other.data);
+	}
+
+
+	template<typename T, class Container>
+	inline typename queue<T, Container>::reference queue<T, Container>::front() {
 		YO_ASSERT_THROW(data.empty(), "Empty queue");
 		return data.front();
 	}
 
 
 	template<typename T, class Container>
-	inline T queue<T, Container>::back() const {
+	inline typename queue<T, Container>::reference queue<T, Container>::back() {
+		YO_ASSERT_THROW(data.empty(), "Empty queue");
+		return data.back();
+	}
+
+
+	template<typename T, class Container>
+	inline typename queue<T, Container>::const_reference queue<T, Container>::front() const {
+		YO_ASSERT_THROW(data.empty(), "Empty queue");
+		return data.front();
+	}
+
+
+	template<typename T, class Container>
+	inline typename queue<T, Container>::const_reference queue<T, Container>::back() const {
 		YO_ASSERT_THROW(data.empty(), "Empty queue");
 		return data.back();
 	}
@@ -72,4 +124,10 @@ namespace yo {
 	}
 
 
+	template<typename T, class Container>
+	void swap(queue<T, Container>& left, queue<T, Container>& right) noexcept {
+		left.swap(right);
+	}
+
+
 }
@@ -0,0 +1,412 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include "utility.h"
+#include "iterators/ring_buffer_iterator.h"
+
+
+namespace yo {
+
+
+	template<typename T>
+	class ring_buffer {
+	public:
+		typedef T                                                             value;
+		typedef T&                                                            reference;
+		typedef const T&                                                      const_reference;
+		typedef ring_buffer<T>                                                this_type;
+		typedef ring_buffer_iterator<T, T&>                                   iterator;
+		typedef ring_buffer_iterator<const T, const T&>                       const_iterator;
+	public:
+		ring_buffer                    ()                                     noexcept;
+		ring_buffer                    (const std::initializer_list<T>& items);
+		ring_buffer                    (const this_type& other);
+		ring_buffer                    (this_type&& other)                    noexcept;
+
+		~ring_buffer                   ()                                     noexcept;
+
+		void push_back                 (const T& item);
+		void push_back                 (T&& item);
+		void push_front                (const T& item);
+		void push_front                (T&& item);
+		template<typename... Args>
+		reference emplace_back         (Args&&... args);
+		template<typename... Args>
+		reference emplace_front        (Args&&... args);
+
+		void pop_back                  ();
+		void pop_front                 ();
+		void clear                     ()                                     noexcept;
+		void reserve                   (size_t newcap);
+		void swap                      (this_type& other)                     noexcept;
+
+		iterator begin                 ()                                     noexcept;
+		const_iterator begin           ()const                                noexcept;
+		const_iterator cbegin          ()const                                noexcept;
+
+		iterator end                   ()                                     noexcept;
+		const_iterator end             ()const                                noexcept;
+		const_iterator cend            ()const                                noexcept;
+
+		bool empty                     ()const                                noexcept;
+		bool full                      ()const                                noexcept;
+
+		size_t size                    ()const                                noexcept;
+		size_t max_size                ()const                                noexcept;
+		size_t capacity                ()const                                noexcept;
+
+		reference front                ();
+		reference back                 ();
+		const_reference front          ()const;
+		const_reference back           ()const;
+
+		reference operator[]           (size_t pos);
+		const_reference operator[]     (size_t pos)const;
+
+		this_type& operator=           (const this_type& other);
+		this_type& operator=           (this_type&& other)                    noexcept;
+	protected:
+		size_t HEAD;
+		size_t SIZE;
+		size_t CAP;
+
+		T*     elems;
+	private:
+		T* slot                        (size_t pos)const                      noexcept;
+		void grow                      ();
+		static size_t round_up         (size_t count)                         noexcept;
+	};
+
+
+	template<typename T>
+	inline ring_buffer<T>::ring_buffer() noexcept {
+		HEAD = SIZE = CAP = 0;
+		elems = nullptr;
+	}
+
+
+	template<typename T>
+	inline ring_buffer<T>::ring_buffer(const std::initializer_list<T>& items) : ring_buffer() {
+		reserve(items.size());
+		for (const T& item : items) {
+			new (slot(SIZE++)) T(item);
+		}
+	}
+
+
+	template<typename T>
+	inline ring_buffer<T>::ring_buffer(const this_type& other) : ring_buffer() {
+		*this = other;
+	}
+
+
+	template<typename T>
+	inline ring_buffer<T>::ring_buffer(this_type&& other) noexcept : ring_buffer() {
+		swap(other);
+	}
+
+
+	template<typename T>
+	inline ring_buffer<T>::~ring_buffer() noexcept {
+		clear();
+		::operator delete(elems);
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::push_back(const T& item) {
+		emplace_back(item);
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::push_front(const T& item) {
+		emplace_front(item);
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::push_front(T&& item) {
+		emplace_front(std::move(item));
+	}
+
+
+	template<typename T>
+	template<typename... Args>
+	inline typename ring_buffer<T>::reference ring_buffer<T>::emplace_back(Args&&... args) {
+		if (SIZE == CAP) {
+			T item(std::forward<Args>(args)...);
+			grow();
+			return *new (slot(SIZE++)) T(std::move(item));
+		}
+		return *new (slot(SIZE++)) T(std::forward<Args>(args)...);
+	}
+
+
+	template<typename T>
+	template<typename... Args>
+	inline typename ring_buffer<T>::reference ring_buffer<T>::emplace_front(Args&&... args) {
+		if (SIZE == CAP) {
+			T item(std::forward<Args>(args)...);
+			grow();
+			HEAD = (HEAD - 1) & (CAP - 1);
+			++SIZE;
+			return *new (slot(0)) T(std::move(item));
+		}
+		HEAD = (HEAD - 1) & (CAP - 1);
+		++SIZE;
+		return *new (slot(0)) T(std::forward<Args>(args)...);
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::pop_back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		slot(--SIZE)->~T();
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::pop_front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		slot(0)->~T();
+		HEAD = (HEAD + 1) & (CAP - 1);
+		--SIZE;
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::clear() noexcept {
+		while (SIZE > 0) {
+			slot(--SIZE)->~T();
+		}
+		HEAD = 0;
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::reserve(size_t newcap) {
+		if (newcap <= CAP) {
+			return;
+		}
+
+		newcap = round_up(newcap);
+		T* _new = static_cast<T*>(::operator new(newcap * sizeof(T)));
+		for (size_t i = 0; i < SIZE; ++i) {
+			T* item = slot(i);
+			new (_new + i) T(std::move(*item));
+			item->~T();
+		}
+		::operator delete(elems);
+
+		elems = _new;
+		CAP = newcap;
+		HEAD = 0;
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::swap(this_type& other) noexcept {
+		yo::swap(HEAD, other.HEAD);
+		yo::swap(SIZE, other.SIZE);
+		yo::swap(CAP, other.CAP);
+		yo::swap(elems, other.elems);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::iterator ring_buffer<T>::begin() noexcept {
+		return iterator(elems, CAP - 1, HEAD);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_iterator ring_buffer<T>::begin() const noexcept {
+		return const_iterator(elems, CAP - 1, HEAD);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_iterator ring_buffer<T>::cbegin() const noexcept {
+		return begin();
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::iterator ring_buffer<T>::end() noexcept {
+		return iterator(elems, CAP - 1, HEAD + SIZE);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_iterator ring_buffer<T>::end() const noexcept {
+		return const_iterator(elems, CAP - 1, HEAD + SIZE);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_iterator ring_buffer<T>::cend() const noexcept {
+		return end();
+	}
+
+
+	template<typename T>
+	inline bool ring_buffer<T>::empty() const noexcept {
+		return SIZE == 0;
+	}
+
+
+	template<typename T>
+	inline bool ring_buffer<T>::full() const noexcept {
+		return SIZE == CAP;
+	}
+
+
+	template<typename T>
+	inline size_t ring_buffer<T>::size() const noexcept {
+		return SIZE;
+	}
+
+
+	template<typename T>
+	inline size_t ring_buffer<T>::max_size() const noexcept {
+		return (size_t)-1 / sizeof(T);
+	}
+
+
+	template<typename T>
+	inline size_t ring_buffer<T>::capacity() const noexcept {
+		return CAP;
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::reference ring_buffer<T>::front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		return *slot(0);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::reference ring_buffer<T>::back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		return *slot(SIZE - 1);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_reference ring_buffer<T>::front() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		return *slot(0);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_reference ring_buffer<T>::back() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty buffer");
+		return *slot(SIZE - 1);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::reference ring_buffer<T>::operator[](size_t pos) {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return *slot(pos);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::const_reference ring_buffer<T>::operator[](size_t pos) const {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return *slot(pos);
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::this_type& ring_buffer<T>::operator=(const this_type& other) {
+		if (this != &other) {
+			clear();
+			reserve(other.size());
+			for (const T& item : other) {
+				new (slot(SIZE++)) T(item);
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename T>
+	inline typename ring_buffer<T>::this_type& ring_buffer<T>::operator=(this_type&& other) noexcept {
+		if (this != &other) {
+			clear();
+			swap(other);
+		}
+		return *this;
+	}
+
+
+	template<typename T>
+	inline T* ring_buffer<T>::slot(size_t pos) const noexcept {
+		return elems + ((HEAD + pos) & (CAP - 1));
+	}
+
+
+	template<typename T>
+	inline void ring_buffer<T>::grow() {
+		reserve(CAP == 0 ? 8 : CAP * 2);
+	}
+
+
+	template<typename T>
+	inline size_t ring_buffer<T>::round_up(size_t count) noexcept {
+		size_t result = 1;
+		while (result < count) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+
+
+	template<typename T>
+	inline bool operator==(const ring_buffer<T>& left, const ring_buffer<T>& right) {
+		if (left.size() != right.size()) {
+			return false;
+		}
+		for (size_t i = 0; i < left.size(); ++i) {
+			if (!(left[i] == right[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	template<typename T>
+	inline bool operator!=(const ring_buffer<T>& left, const ring_buffer<T>& right) {
+		return !(left == right);
+	}
+
+
+	template<typename T>
+	void swap(ring_buffer<T>& left, ring_buffer<T>& right) noexcept {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
@@ -0,0 +1,502 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+#ifndef YO_ROPE_LEAF_SIZE
+#define YO_ROPE_LEAF_SIZE 512
+#endif
+
+#include <cstring>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "string.h"
+
+
+namespace yo {
+
+
+	struct RopeNode {
+		RopeNode* left;
+		RopeNode* right;
+		char*     data;
+		size_t    length;
+		size_t    height;
+		size_t    refs;
+
+		RopeNode(const char* str, size_t count) noexcept
+		:left(nullptr), right(nullptr), data(new char[count]), length(count), height(0), refs(1)
+		{ std::memcpy(data, str, count); }
+
+		RopeNode(const char* a, size_t acount, const char* b, size_t bcount) noexcept
+		:left(nullptr), right(nullptr), data(new char[acount + bcount]), length(acount + bcount), height(0), refs(1)
+		{ std::memcpy(data, a, acount); std::memcpy(data + acount, b, bcount); }
+
+		RopeNode(RopeNode* left, RopeNode* right) noexcept
+		:left(left), right(right), data(nullptr), length(left->length + right->length), refs(1)
+		{ height = (left->height > right->height ? left->height : right->height) + 1; }
+
+		~RopeNode() noexcept
+		{ delete[] data; }
+	};
+
+
+	class rope {
+	public:
+		typedef RopeNode                            Node;
+		typedef Node*                               pointer_type;
+	public:
+		rope                        ()                                    noexcept;
+		rope                        (const char* str)                     noexcept;
+		rope                        (const char* str, size_t count)       noexcept;
+		rope                        (const string& str)                   noexcept;
+		rope                        (const rope& other)                   noexcept;
+		rope                        (rope&& other)                        noexcept;
+
+		~rope                       ()                                    noexcept;
+
+		void append                 (const char* str, size_t count)       noexcept;
+		void append                 (const rope& other)                   noexcept;
+		void clear                  ()                                    noexcept;
+		void swap                   (rope& other)                         noexcept;
+
+		rope substr                 (size_t pos, size_t count)const;
+
+		string str                  ()const                               noexcept;
+
+		template<typename Function>
+		void for_each_chunk         (Function f)const;
+
+		bool write                  (int fd)const                         noexcept;
+
+		bool empty                  ()const                               noexcept;
+
+		size_t size                 ()const                               noexcept;
+		size_t length               ()const                               noexcept;
+		size_t depth                ()const                               noexcept;
+
+		char at                     (size_t pos)const;
+		char operator[]             (size_t pos)const;
+
+		rope operator+              (const rope& other)const              noexcept;
+		rope& operator+=            (const rope& other)                   noexcept;
+
+		rope& operator=             (const rope& other)                   noexcept;
+		rope& operator=             (rope&& other)                        noexcept;
+
+		friend std::ostream& operator<< (std::ostream& os, const rope& r) noexcept;
+		friend bool operator==          (const rope& left, const rope& right);
+	private:
+		explicit rope               (pointer_type root)                   noexcept;
+
+		static pointer_type acquire (pointer_type node)                   noexcept;
+		static void release         (pointer_type node)                   noexcept;
+
+		static pointer_type join    (pointer_type l, pointer_type r)      noexcept;
+		static pointer_type balance (pointer_type l, pointer_type r)      noexcept;
+		static pointer_type slice   (pointer_type node,
+                                     size_t first, size_t last)           noexcept;
+
+		template<typename Function>
+		static void visit           (pointer_type node, Function& f);
+
+		static bool matches         (pointer_type node, size_t pos,
+                                     const char* str, size_t count)       noexcept;
+
+		static size_t height        (pointer_type node)                   noexcept;
+	private:
+		pointer_type root;
+	};
+
+
+	inline rope::rope() noexcept {
+		root = nullptr;
+	}
+
+
+	inline rope::rope(const char* str) noexcept : rope(str, std::strlen(str)) {}
+
+
+	inline rope::rope(const char* str, size_t count) noexcept : rope() {
+		append(str, count);
+	}
+
+
+	inline rope::rope(const string& str) noexcept : rope(str.data(), str.size()) {}
+
+
+	inline rope::rope(const rope& other) noexcept {
+		root = acquire(other.root);
+	}
+
+
+	inline rope::rope(rope&& other) noexcept {
+		root = other.root;
+		other.root = nullptr;
+	}
+
+
+	inline rope::rope(pointer_type root) noexcept {
+		this->root = root;
+	}
+
+
+	inline rope::~rope() noexcept {
+		release(root);
+	}
+
+
+	inline void rope::append(const char* str, size_t count) noexcept {
+		while (count > 0) {
+			size_t chunk = count < YO_ROPE_LEAF_SIZE ? count : YO_ROPE_LEAF_SIZE;
+			pointer_type leaf = new Node(str, chunk);
+			pointer_type result = join(root, leaf);
+			release(root);
+			release(leaf);
+			root = result;
+			str += chunk;
+			count -= chunk;
+		}
+	}
+
+
+	inline void rope::append(const rope& other) noexcept {
+		pointer_type result = join(root, other.root);
+		release(root);
+		root = result;
+	}
+
+
+	inline void rope::clear() noexcept {
+		release(root);
+		root = nullptr;
+	}
+
+
+	inline void rope::swap(rope& other) noexcept {
+		yo::swap(root, other.root);
+	}
+
+
+	inline rope rope::substr(size_t pos, size_t count) const {
+		YO_ASSERT_THROW(pos > size(), "Out of range");
+		size_t last = count > size() - pos ? size() : pos + count;
+		return rope(slice(root, pos, last));
+	}
+
+
+	inline string rope::str() const noexcept {
+		string result;
+		result.resize(size());
+		char* out = result.data();
+		for_each_chunk([&out](const char* chunk, size_t count) {
+			std::memcpy(out, chunk, count);
+			out += count;
+		});
+		return result;
+	}
+
+
+	template<typename Function>
+	inline void rope::for_each_chunk(Function f) const {
+		visit(root, f);
+	}
+
+
+	inline bool rope::write(int fd) const noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+		const int max_chunks = 64;
+		iovec chunks[max_chunks];
+		int count = 0;
+		bool ok = true;
+
+		auto flush = [&]() {
+			iovec* first = chunks;
+			while (ok && count > 0) {
+				ssize_t written = ::writev(fd, first, count);
+				if (written < 0) {
+					ok = false;
+					break;
+				}
+				while (count > 0 && (size_t)written >= first->iov_len) {
+					written -= first->iov_len;
+					++first;
+					--count;
+				}
+				if (count > 0) {
+					first->iov_base = (char*)first->iov_base + written;
+					first->iov_len -= written;
+				}
+			}
+			count = 0;
+		};
+
+		for_each_chunk([&](const char* chunk, size_t length) {
+			chunks[count].iov_base = (void*)chunk;
+			chunks[count].iov_len = length;
+			if (++count == max_chunks) {
+				flush();
+			}
+		});
+		flush();
+
+		return ok;
+#else
+		return false;
+#endif
+	}
+
+
+	inline bool rope::empty() const noexcept {
+		return root == nullptr;
+	}
+
+
+	inline size_t rope::size() const noexcept {
+		return root == nullptr ? 0 : root->length;
+	}
+
+
+	inline size_t rope::length() const noexcept {
+		return size();
+	}
+
+
+	inline size_t rope::depth() const noexcept {
+		return height(root);
+	}
+
+
+	inline char rope::at(size_t pos) const {
+		YO_ASSERT_THROW(pos >= size(), "Out of range");
+		pointer_type node = root;
+		while (node->data == nullptr) {
+			if (pos < node->left->length) {
+				node = node->left;
+			}
+			else {
+				pos -= node->left->length;
+				node = node->right;
+			}
+		}
+		return node->data[pos];
+	}
+
+
+	inline char rope::operator[](size_t pos) const {
+		return at(pos);
+	}
+
+
+	inline rope rope::operator+(const rope& other) const noexcept {
+		return rope(join(root, other.root));
+	}
+
+
+	inline rope& rope::operator+=(const rope& other) noexcept {
+		append(other);
+		return *this;
+	}
+
+
+	inline rope& rope::operator=(const rope& other) noexcept {
+		if (this != &other) {
+			pointer_type temp = acquire(other.root);
+			release(root);
+			root = temp;
+		}
+		return *this;
+	}
+
+
+	inline rope& rope::operator=(rope&& other) noexcept {
+		swap(other);
+		return *this;
+	}
+
+
+	inline rope::pointer_type rope::acquire(pointer_type node) noexcept {
+		if (node != nullptr) {
+			++node->refs;
+		}
+		return node;
+	}
+
+
+	inline void rope::release(pointer_type node) noexcept {
+		if (node != nullptr && --node->refs == 0) {
+			release(node->left);
+			release(node->right);
+			delete node;
+		}
+	}
+
+
+	inline rope::pointer_type rope::join(pointer_type l, pointer_type r) noexcept {
+		if (l == nullptr || l->length == 0) {
+			return acquire(r);
+		}
+		if (r == nullptr || r->length == 0) {
+			return acquire(l);
+		}
+
+		if (l->data != nullptr && r->data != nullptr && l->length + r->length <= YO_ROPE_LEAF_SIZE) {
+			return new Node(l->data, l->length, r->data, r->length);
+		}
+
+		if (l->height > r->height + 1) {
+			pointer_type temp = join(l->right, r);
+			pointer_type result = balance(l->left, temp);
+			release(temp);
+			return result;
+		}
+		if (r->height > l->height + 1) {
+			pointer_type temp = join(l, r->left);
+			pointer_type result = balance(temp, r->right);
+			release(temp);
+			return result;
+		}
+
+		return new Node(acquire(l), acquire(r));
+	}
+
+
+	inline rope::pointer_type rope::balance(pointer_type l, pointer_type r) noexcept {
+		if (l->height > r->height + 1) {
+			if (height(l->left) >= height(l->right)) {
+				pointer_type inner = new Node(acquire(l->right), acquire(r));
+				return new Node(acquire(l->left), inner);
+			}
+			pointer_type a = new Node(acquire(l->left), acquire(l->right->left));
+			pointer_type b = new Node(acquire(l->right->right), acquire(r));
+			return new Node(a, b);
+		}
+		if (r->height > l->height + 1) {
+			if (height(r->right) >= height(r->left)) {
+				pointer_type inner = new Node(acquire(l), acquire(r->left));
+				return new Node(inner, acquire(r->right));
+			}
+			pointer_type a = new Node(acquire(l), acquire(r->left->left));
+			pointer_type b = new Node(acquire(r->left->right), acquire(r->right));
+			return new Node(a, b);
+		}
+		return new Node(acquire(l), acquire(r));
+	}
+
+
+	inline rope::pointer_type rope::slice(pointer_type node, size_t first, size_t last) noexcept {
+		if (node == nullptr || first >= last) {
+			return nullptr;
+		}
+		if (first == 0 && last == node->length) {
+			return acquire(node);
+		}
+		if (node->data != nullptr) {
+			return new Node(node->data + first, last - first);
+		}
+
+		size_t middle = node->left->length;
+		if (last <= middle) {
+			return slice(node->left, first, last);
+		}
+		if (first >= middle) {
+			return slice(node->right, first - middle, last - middle);
+		}
+
+		pointer_type l = slice(node->left, first, middle);
+		pointer_type r = slice(node->right, 0, last - middle);
+		pointer_type result = join(l, r);
+		release(l);
+		release(r);
+		return result;
+	}
+
+
+	template<typename Function>
+	inline void rope::visit(pointer_type node, Function& f) {
+		while (node != nullptr) {
+			if (node->data != nullptr) {
+				f((const char*)node->data, node->length);
+				return;
+			}
+			visit(node->left, f);
+			node = node->right;
+		}
+	}
+
+
+	inline bool rope::matches(pointer_type node, size_t pos, const char* str, size_t count) noexcept {
+		while (count > 0) {
+			if (node->data != nullptr) {
+				return std::memcmp(node->data + pos, str, count) == 0;
+			}
+			size_t middle = node->left->length;
+			if (pos >= middle) {
+				pos -= middle;
+				node = node->right;
+				continue;
+			}
+			size_t chunk = count < middle - pos ? count : middle - pos;
+			if (!matches(node->left, pos, str, chunk)) {
+				return false;
+			}
+			str += chunk;
+			count -= chunk;
+			pos = 0;
+			node = node->right;
+		}
+		return true;
+	}
+
+
+	inline size_t rope::height(pointer_type node) noexcept {
+		return node == nullptr ? 0 : node->height;
+	}
+
+
+
+	inline std::ostream& operator<<(std::ostream& os, const rope& r) noexcept {
+		r.for_each_chunk([&os](const char* chunk, size_t count) {
+			os.write(chunk, count);
+		});
+		return os;
+	}
+
+
+	inline bool operator==(const rope& left, const rope& right) {
+		if (left.size() != right.size()) {
+			return false;
+		}
+		if (left.root == right.root) {
+			return true;
+		}
+		bool equal = true;
+		size_t pos = 0;
+		left.for_each_chunk([&](const char* chunk, size_t count) {
+			if (equal) {
+				equal = rope::matches(right.root, pos, chunk, count);
+				pos += count;
+			}
+		});
+		return equal;
+	}
+
+
+	inline bool operator!=(const rope& left, const rope& right) {
+		return !(left == right);
+	}
+
+
+	inline void swap(rope& left, rope& right) {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
@@ -0,0 +1,592 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define YO_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+namespace yo {
+
+
+	enum class simd_level {
+		scalar,
+		sse2,
+		avx2,
+		avx512
+	};
+
+
+	template<typename T>
+	struct is_simd_type : std::integral_constant<bool,
+		std::is_arithmetic<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, long double>::value &&
+		(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+
+	inline simd_level simd_support() noexcept {
+#if defined(YO_SIMD_X86)
+		static const simd_level level = [] {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+				return simd_level::avx512;
+			}
+			if (__builtin_cpu_supports("avx2")) {
+				return simd_level::avx2;
+			}
+			return simd_level::sse2;
+		}();
+		return level;
+#else
+		return simd_level::scalar;
+#endif
+	}
+
+
+	template<typename T>
+	inline bool simd_comparable(const T& item) noexcept {
+		if (std::is_floating_point<T>::value) {
+			return item == item && item != 0;
+		}
+		return true;
+	}
+
+
+#if defined(YO_SIMD_X86)
+	struct SimdSse2 {
+		static const size_t BYTES = 16;
+
+		template<typename T>
+		static __m128i broadcast(const T& item) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				uint8_t bits;
+				std::memcpy(&bits, &item, 1);
+				return _mm_set1_epi8((char)bits);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				uint16_t bits;
+				std::memcpy(&bits, &item, 2);
+				return _mm_set1_epi16((short)bits);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				uint32_t bits;
+				std::memcpy(&bits, &item, 4);
+				return _mm_set1_epi32((int)bits);
+			}
+			else {
+				uint64_t bits;
+				std::memcpy(&bits, &item, 8);
+				return _mm_set1_epi64x((long long)bits);
+			}
+		}
+
+		template<typename T>
+		static __m128i reverse_lanes(__m128i v) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+			}
+			if constexpr (sizeof(T) <= 2) {
+				v = _mm_shufflelo_epi16(v, 0x1B);
+				v = _mm_shufflehi_epi16(v, 0x1B);
+				return _mm_shuffle_epi32(v, 0x4E);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				return _mm_shuffle_epi32(v, 0x1B);
+			}
+			else {
+				return _mm_shuffle_epi32(v, 0x4E);
+			}
+		}
+
+		template<typename T>
+		static uint64_t match(__m128i v, __m128i needle) noexcept {
+			__m128i equal;
+			if constexpr (sizeof(T) == 1) {
+				equal = _mm_cmpeq_epi8(v, needle);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				equal = _mm_cmpeq_epi16(v, needle);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				equal = _mm_cmpeq_epi32(v, needle);
+			}
+			else {
+				equal = _mm_cmpeq_epi32(v, needle);
+				equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, 0xB1));
+			}
+			return (uint64_t)_mm_movemask_epi8(equal);
+		}
+
+		template<typename T>
+		static void fill(T* first, T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m128i value = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(first), value);
+			}
+			for (; first != last; ++first) {
+				*first = item;
+			}
+		}
+
+		template<typename T>
+		static void reverse(T* first, T* last) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			while ((size_t)(last - first) >= LANES * 2) {
+				last -= LANES;
+				__m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				__m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(first), reverse_lanes<T>(tail));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(last), reverse_lanes<T>(head));
+				first += LANES;
+			}
+			while (last - first > 1) {
+				T temp = *first;
+				*first++ = *--last;
+				*last = temp;
+			}
+		}
+
+		template<typename T>
+		static const T* find(const T* first, const T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m128i needle = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				uint64_t mask = match<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle);
+				if (mask != 0) {
+					return first + __builtin_ctzll(mask) / sizeof(T);
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					return first;
+				}
+			}
+			return last;
+		}
+
+		template<typename T>
+		static T* remove(T* first, T* last, const T& item, T*& hit) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m128i needle = broadcast(item);
+			T* out = first;
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				uint64_t mask = match<T>(v, needle);
+				if (mask == 0) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+					out += LANES;
+					continue;
+				}
+				for (size_t i = 0; i < LANES; ++i) {
+					if (mask & ((uint64_t)1 << (i * sizeof(T)))) {
+						hit = out;
+					}
+					else {
+						*out++ = first[i];
+					}
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					hit = out;
+				}
+				else {
+					*out++ = *first;
+				}
+			}
+			return out;
+		}
+	};
+
+
+	struct SimdAvx2 {
+		static const size_t BYTES = 32;
+
+		template<typename T>
+		__attribute__((target("avx2"))) static __m256i broadcast(const T& item) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				uint8_t bits;
+				std::memcpy(&bits, &item, 1);
+				return _mm256_set1_epi8((char)bits);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				uint16_t bits;
+				std::memcpy(&bits, &item, 2);
+				return _mm256_set1_epi16((short)bits);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				uint32_t bits;
+				std::memcpy(&bits, &item, 4);
+				return _mm256_set1_epi32((int)bits);
+			}
+			else {
+				uint64_t bits;
+				std::memcpy(&bits, &item, 8);
+				return _mm256_set1_epi64x((long long)bits);
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static __m256i reverse_lanes(__m256i v) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+				                                       15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+				return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, order), 0x4E);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				const __m256i order = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+				                                       14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+				return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, order), 0x4E);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+			}
+			else {
+				return _mm256_permute4x64_epi64(v, 0x1B);
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static uint64_t match(__m256i v, __m256i needle) noexcept {
+			__m256i equal;
+			if constexpr (sizeof(T) == 1) {
+				equal = _mm256_cmpeq_epi8(v, needle);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				equal = _mm256_cmpeq_epi16(v, needle);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				equal = _mm256_cmpeq_epi32(v, needle);
+			}
+			else {
+				equal = _mm256_cmpeq_epi64(v, needle);
+			}
+			return (uint64_t)(uint32_t)_mm256_movemask_epi8(equal);
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static void fill(T* first, T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m256i value = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(first), value);
+			}
+			for (; first != last; ++first) {
+				*first = item;
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static void reverse(T* first, T* last) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			while ((size_t)(last - first) >= LANES * 2) {
+				last -= LANES;
+				__m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+				__m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(first), reverse_lanes<T>(tail));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(last), reverse_lanes<T>(head));
+				first += LANES;
+			}
+			SimdSse2::reverse(first, last);
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static const T* find(const T* first, const T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m256i needle = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				uint64_t mask = match<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle);
+				if (mask != 0) {
+					return first + __builtin_ctzll(mask) / sizeof(T);
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					return first;
+				}
+			}
+			return last;
+		}
+
+		template<typename T>
+		__attribute__((target("avx2"))) static T* remove(T* first, T* last, const T& item, T*& hit) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m256i needle = broadcast(item);
+			T* out = first;
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+				uint64_t mask = match<T>(v, needle);
+				if (mask == 0) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+					out += LANES;
+					continue;
+				}
+				for (size_t i = 0; i < LANES; ++i) {
+					if (mask & ((uint64_t)1 << (i * sizeof(T)))) {
+						hit = out;
+					}
+					else {
+						*out++ = first[i];
+					}
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					hit = out;
+				}
+				else {
+					*out++ = *first;
+				}
+			}
+			return out;
+		}
+	};
+
+
+	struct SimdAvx512 {
+		static const size_t BYTES = 64;
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static __m512i broadcast(const T& item) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				uint8_t bits;
+				std::memcpy(&bits, &item, 1);
+				return _mm512_set1_epi8((char)bits);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				uint16_t bits;
+				std::memcpy(&bits, &item, 2);
+				return _mm512_set1_epi16((short)bits);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				uint32_t bits;
+				std::memcpy(&bits, &item, 4);
+				return _mm512_set1_epi32((int)bits);
+			}
+			else {
+				uint64_t bits;
+				std::memcpy(&bits, &item, 8);
+				return _mm512_set1_epi64((long long)bits);
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static __m512i reverse_lanes(__m512i v) noexcept {
+			if constexpr (sizeof(T) <= 2) {
+				const __m128i order = sizeof(T) == 1
+					? _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+					: _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+				v = _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(order));
+				return _mm512_permutexvar_epi64(_mm512_setr_epi64(6, 7, 4, 5, 2, 3, 0, 1), v);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				return _mm512_permutexvar_epi32(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+			}
+			else {
+				return _mm512_permutexvar_epi64(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), v);
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static uint64_t match(__m512i v, __m512i needle) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				return (uint64_t)_mm512_cmpeq_epi8_mask(v, needle);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				return (uint64_t)_mm512_cmpeq_epi16_mask(v, needle);
+			}
+			else if constexpr (sizeof(T) == 4) {
+				return (uint64_t)_mm512_cmpeq_epi32_mask(v, needle);
+			}
+			else {
+				return (uint64_t)_mm512_cmpeq_epi64_mask(v, needle);
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static void fill(T* first, T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m512i value = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				_mm512_storeu_si512(first, value);
+			}
+			for (; first != last; ++first) {
+				*first = item;
+			}
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static void reverse(T* first, T* last) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			while ((size_t)(last - first) >= LANES * 2) {
+				last -= LANES;
+				__m512i head = _mm512_loadu_si512(first);
+				__m512i tail = _mm512_loadu_si512(last);
+				_mm512_storeu_si512(first, reverse_lanes<T>(tail));
+				_mm512_storeu_si512(last, reverse_lanes<T>(head));
+				first += LANES;
+			}
+			SimdSse2::reverse(first, last);
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static const T* find(const T* first, const T* last, const T& item) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			__m512i needle = broadcast(item);
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				uint64_t mask = match<T>(_mm512_loadu_si512(first), needle);
+				if (mask != 0) {
+					return first + __builtin_ctzll(mask);
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					return first;
+				}
+			}
+			return last;
+		}
+
+		template<typename T>
+		__attribute__((target("avx512f,avx512bw"))) static T* remove(T* first, T* last, const T& item, T*& hit) noexcept {
+			const size_t LANES = BYTES / sizeof(T);
+			const uint64_t ALL = LANES == 64 ? ~(uint64_t)0 : ((uint64_t)1 << LANES) - 1;
+			__m512i needle = broadcast(item);
+			T* out = first;
+			for (; (size_t)(last - first) >= LANES; first += LANES) {
+				__m512i v = _mm512_loadu_si512(first);
+				uint64_t mask = match<T>(v, needle);
+				if (mask == 0) {
+					_mm512_storeu_si512(out, v);
+					out += LANES;
+					continue;
+				}
+
+				uint64_t keep = ~mask & ALL;
+				uint64_t before = keep & ((((uint64_t)1 << (63 - __builtin_clzll(mask))) - 1));
+				hit = out + __builtin_popcountll(before);
+				if constexpr (sizeof(T) == 4) {
+					_mm512_mask_compressstoreu_epi32(out, (__mmask16)keep, v);
+				}
+				else if constexpr (sizeof(T) == 8) {
+					_mm512_mask_compressstoreu_epi64(out, (__mmask8)keep, v);
+				}
+				else {
+					T* write = out;
+					for (size_t i = 0; i < LANES; ++i) {
+						if (keep & ((uint64_t)1 << i)) {
+							*write++ = first[i];
+						}
+					}
+				}
+				out += __builtin_popcountll(keep);
+			}
+			for (; first != last; ++first) {
+				if (*first == item) {
+					hit = out;
+				}
+				else {
+					*out++ = *first;
+				}
+			}
+			return out;
+		}
+	};
+#endif
+
+
+	template<typename T>
+	inline void simd_fill(T* first, T* last, const T& item) noexcept(is_simd_type<T>::value) {
+#if defined(YO_SIMD_X86)
+		if constexpr (is_simd_type<T>::value) {
+			switch (simd_support()) {
+			case simd_level::avx512: SimdAvx512::fill(first, last, item); return;
+			case simd_level::avx2:   SimdAvx2::fill(first, last, item);   return;
+			default:                 SimdSse2::fill(first, last, item);   return;
+			}
+		}
+#endif
+		for (; first != last; ++first) {
+			*first = item;
+		}
+	}
+
+
+	template<typename T>
+	inline void simd_reverse(T* first, T* last) noexcept(is_simd_type<T>::value) {
+#if defined(YO_SIMD_X86)
+		if constexpr (is_simd_type<T>::value) {
+			switch (simd_support()) {
+			case simd_level::avx512: SimdAvx512::reverse(first, last); return;
+			case simd_level::avx2:   SimdAvx2::reverse(first, last);   return;
+			default:                 SimdSse2::reverse(first, last);   return;
+			}
+		}
+#endif
+		while (last - first > 1) {
+			T temp(std::move(*first));
+			*first++ = std::move(*--last);
+			*last = std::move(temp);
+		}
+	}
+
+
+	template<typename T>
+	inline const T* simd_find(const T* first, const T* last, const T& item) noexcept(is_simd_type<T>::value) {
+#if defined(YO_SIMD_X86)
+		if constexpr (is_simd_type<T>::value) {
+			if (simd_comparable(item)) {
+				switch (simd_support()) {
+				case simd_level::avx512: return SimdAvx512::find(first, last, item);
+				case simd_level::avx2:   return SimdAvx2::find(first, last, item);
+				default:                 return SimdSse2::find(first, last, item);
+				}
+			}
+		}
+#endif
+		for (; first != last; ++first) {
+			if (*first == item) {
+				return first;
+			}
+		}
+		return last;
+	}
+
+
+	template<typename T>
+	inline T* simd_remove(T* first, T* last, const T& item, T*& hit) noexcept(is_simd_type<T>::value) {
+#if defined(YO_SIMD_X86)
+		if constexpr (is_simd_type<T>::value) {
+			if (simd_comparable(item)) {
+				switch (simd_support()) {
+				case simd_level::avx512: return SimdAvx512::remove(first, last, item, hit);
+				case simd_level::avx2:   return SimdAvx2::remove(first, last, item, hit);
+				default:                 return SimdSse2::remove(first, last, item, hit);
+				}
+			}
+		}
+#endif
+		T* out = first;
+		for (; first != last; ++first) {
+			if (*first == item) {
+				hit = out;
+			}
+			else {
+				if (out != first) {
+					*out = std::move(*first);
+				}
+				++out;
+			}
+		}
+		return out;
+	}
+
+
+}
@@ -0,0 +1,473 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include "utility.h"
+#include "iterators/reverse_iterator.h"
+
+
+namespace yo {
+
+
+	template<typename T, size_t INLINE = 16>
+	class small_vector {
+	public:
+		typedef T                                                             value;
+		typedef T&                                                            reference;
+		typedef const T&                                                      const_reference;
+		typedef T*                                                            iterator;
+		typedef const T*                                                      const_iterator;
+		typedef small_vector<T, INLINE>                                       this_type;
+		typedef reverse_iterator<T, const T*, const T&, const_iterator>       const_reverse_iterator;
+		typedef reverse_iterator<T, T*, T&, iterator>                         reverse_iterator;
+	public:
+		small_vector                   ()                                     noexcept;
+		small_vector                   (const std::initializer_list<T>& items);
+		small_vector                   (const this_type& other);
+		small_vector                   (this_type&& other)                    noexcept;
+
+		~small_vector                  ()                                     noexcept;
+
+		void push_back                 (const T& item);
+		void push_back                 (T&& item);
+		template<typename... Args>
+		reference emplace_back         (Args&&... args);
+
+		void pop_back                  ();
+		void clear                     ()                                     noexcept;
+		void reserve                   (size_t newcap);
+		void swap                      (this_type& other)                     noexcept;
+
+		iterator begin                 ()                                     noexcept;
+		const_iterator begin           ()const                                noexcept;
+		const_iterator cbegin          ()const                                noexcept;
+		reverse_iterator rbegin        ()                                     noexcept;
+		const_reverse_iterator rbegin  ()const                                noexcept;
+
+		iterator end                   ()                                     noexcept;
+		const_iterator end             ()const                                noexcept;
+		const_iterator cend            ()const                                noexcept;
+		reverse_iterator rend          ()                                     noexcept;
+		const_reverse_iterator rend    ()const                                noexcept;
+
+		bool empty                     ()const                                noexcept;
+		bool is_inline                 ()const                                noexcept;
+
+		size_t size                    ()const                                noexcept;
+		size_t max_size                ()const                                noexcept;
+		size_t capacity                ()const                                noexcept;
+
+		reference front                ();
+		reference back                 ();
+		const_reference front          ()const;
+		const_reference back           ()const;
+
+		T* data                        ()                                     noexcept;
+		const T* data                  ()const                                noexcept;
+
+		reference operator[]           (size_t pos);
+		const_reference operator[]     (size_t pos)const;
+
+		this_type& operator=           (const this_type& other);
+		this_type& operator=           (this_type&& other)                    noexcept;
+	protected:
+		size_t SIZE;
+		size_t CAP;
+
+		T*     elems;
+	private:
+		T* buffer                      ()                                     noexcept;
+		void grow                      ();
+		void adopt_inline              (this_type& other)                     noexcept;
+		void steal                     (this_type& other)                     noexcept;
+		void release                   ()                                     noexcept;
+		static void relocate           (T* first, T* last, T* dest)           noexcept;
+	private:
+		alignas(T) unsigned char storage[sizeof(T) * (INLINE == 0 ? 1 : INLINE)];
+	};
+
+
+	template<typename T, size_t INLINE>
+	inline small_vector<T, INLINE>::small_vector() noexcept {
+		SIZE = 0;
+		CAP = INLINE;
+		elems = buffer();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline small_vector<T, INLINE>::small_vector(const std::initializer_list<T>& items) : small_vector() {
+		reserve(items.size());
+		for (const T& item : items) {
+			new (elems + SIZE++) T(item);
+		}
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline small_vector<T, INLINE>::small_vector(const this_type& other) : small_vector() {
+		*this = other;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline small_vector<T, INLINE>::small_vector(this_type&& other) noexcept : small_vector() {
+		steal(other);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline small_vector<T, INLINE>::~small_vector() noexcept {
+		release();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::push_back(const T& item) {
+		if (SIZE == CAP) {
+			T copy(item);
+			grow();
+			new (elems + SIZE++) T(std::move(copy));
+			return;
+		}
+		new (elems + SIZE++) T(item);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+
+	template<typename T, size_t INLINE>
+	template<typename... Args>
+	inline typename small_vector<T, INLINE>::reference small_vector<T, INLINE>::emplace_back(Args&&... args) {
+		if (SIZE == CAP) {
+			T item(std::forward<Args>(args)...);
+			grow();
+			return *new (elems + SIZE++) T(std::move(item));
+		}
+		return *new (elems + SIZE++) T(std::forward<Args>(args)...);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::pop_back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		elems[--SIZE].~T();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::clear() noexcept {
+		while (SIZE > 0) {
+			elems[--SIZE].~T();
+		}
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::reserve(size_t newcap) {
+		if (newcap <= CAP) {
+			return;
+		}
+
+		T* _new = static_cast<T*>(::operator new(newcap * sizeof(T)));
+		relocate(elems, elems + SIZE, _new);
+		if (!is_inline()) {
+			::operator delete(elems);
+		}
+		elems = _new;
+		CAP = newcap;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::swap(this_type& other) noexcept {
+		if (!is_inline() && !other.is_inline()) {
+			yo::swap(elems, other.elems);
+			yo::swap(SIZE, other.SIZE);
+			yo::swap(CAP, other.CAP);
+		}
+		else if (is_inline() && other.is_inline()) {
+			this_type& longer = SIZE > other.SIZE ? *this : other;
+			this_type& shorter = SIZE > other.SIZE ? other : *this;
+			for (size_t i = 0; i < shorter.SIZE; ++i) {
+				yo::swap(elems[i], other.elems[i]);
+			}
+			relocate(longer.elems + shorter.SIZE, longer.elems + longer.SIZE, shorter.elems + shorter.SIZE);
+			yo::swap(SIZE, other.SIZE);
+		}
+		else if (is_inline()) {
+			other.adopt_inline(*this);
+		}
+		else {
+			adopt_inline(other);
+		}
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::iterator small_vector<T, INLINE>::begin() noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_iterator small_vector<T, INLINE>::begin() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_iterator small_vector<T, INLINE>::cbegin() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::reverse_iterator small_vector<T, INLINE>::rbegin() noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_reverse_iterator small_vector<T, INLINE>::rbegin() const noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::iterator small_vector<T, INLINE>::end() noexcept {
+		return elems + SIZE;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_iterator small_vector<T, INLINE>::end() const noexcept {
+		return elems + SIZE;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_iterator small_vector<T, INLINE>::cend() const noexcept {
+		return elems + SIZE;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::reverse_iterator small_vector<T, INLINE>::rend() noexcept {
+		return begin();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_reverse_iterator small_vector<T, INLINE>::rend() const noexcept {
+		return begin();
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline bool small_vector<T, INLINE>::empty() const noexcept {
+		return SIZE == 0;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline bool small_vector<T, INLINE>::is_inline() const noexcept {
+		return elems == reinterpret_cast<const T*>(storage);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline size_t small_vector<T, INLINE>::size() const noexcept {
+		return SIZE;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline size_t small_vector<T, INLINE>::max_size() const noexcept {
+		return (size_t)-1 / sizeof(T);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline size_t small_vector<T, INLINE>::capacity() const noexcept {
+		return CAP;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::reference small_vector<T, INLINE>::front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return elems[0];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::reference small_vector<T, INLINE>::back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return elems[SIZE - 1];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_reference small_vector<T, INLINE>::front() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return elems[0];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_reference small_vector<T, INLINE>::back() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return elems[SIZE - 1];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline T* small_vector<T, INLINE>::data() noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline const T* small_vector<T, INLINE>::data() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::reference small_vector<T, INLINE>::operator[](size_t pos) {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return elems[pos];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::const_reference small_vector<T, INLINE>::operator[](size_t pos) const {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return elems[pos];
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::this_type& small_vector<T, INLINE>::operator=(const this_type& other) {
+		if (this != &other) {
+			clear();
+			reserve(other.size());
+			for (const T& item : other) {
+				new (elems + SIZE++) T(item);
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline typename small_vector<T, INLINE>::this_type& small_vector<T, INLINE>::operator=(this_type&& other) noexcept {
+		if (this != &other) {
+			release();
+			steal(other);
+		}
+		return *this;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline T* small_vector<T, INLINE>::buffer() noexcept {
+		return reinterpret_cast<T*>(storage);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::grow() {
+		reserve(CAP == 0 ? 1 : CAP * 2);
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::adopt_inline(this_type& other) noexcept {
+		T* heap = elems;
+		size_t length = SIZE;
+		size_t cap = CAP;
+
+		elems = buffer();
+		relocate(other.elems, other.elems + other.SIZE, elems);
+		SIZE = other.SIZE;
+		CAP = INLINE;
+
+		other.elems = heap;
+		other.SIZE = length;
+		other.CAP = cap;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::steal(this_type& other) noexcept {
+		if (other.is_inline()) {
+			relocate(other.elems, other.elems + other.SIZE, elems);
+			SIZE = other.SIZE;
+			other.SIZE = 0;
+			return;
+		}
+
+		elems = other.elems;
+		SIZE = other.SIZE;
+		CAP = other.CAP;
+
+		other.elems = other.buffer();
+		other.SIZE = 0;
+		other.CAP = INLINE;
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::release() noexcept {
+		clear();
+		if (!is_inline()) {
+			::operator delete(elems);
+			elems = buffer();
+			CAP = INLINE;
+		}
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline void small_vector<T, INLINE>::relocate(T* first, T* last, T* dest) noexcept {
+		for (; first != last; ++first, ++dest) {
+			new (dest) T(std::move(*first));
+			first->~T();
+		}
+	}
+
+
+
+	template<typename T, size_t INLINE>
+	inline bool operator==(const small_vector<T, INLINE>& left, const small_vector<T, INLINE>& right) {
+		return left.size() == right.size() && yo::equal(left.begin(), left.end(), right.begin());
+	}
+
+
+	template<typename T, size_t INLINE>
+	inline bool operator!=(const small_vector<T, INLINE>& left, const small_vector<T, INLINE>& right) {
+		return !(left == right);
+	}
+
+
+	template<typename T, size_t INLINE>
+	void swap(small_vector<T, INLINE>& left, small_vector<T, INLINE>& right) noexcept {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
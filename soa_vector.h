@@ -0,0 +1,521 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "utility.h"
+#include "iterators/soa_vector_iterator.h"
+
+
+namespace yo {
+
+
+	template<typename T>
+	class soa_column {
+	public:
+		typedef T                                                             value;
+		typedef T&                                                            reference;
+		typedef T*                                                            iterator;
+	public:
+		soa_column                     (T* elems, size_t size)                noexcept;
+
+		iterator begin                 ()const                                noexcept;
+		iterator end                   ()const                                noexcept;
+
+		T* data                        ()const                                noexcept;
+
+		bool empty                     ()const                                noexcept;
+
+		size_t size                    ()const                                noexcept;
+
+		reference operator[]           (size_t pos)const                      noexcept;
+	protected:
+		T*     elems;
+		size_t SIZE;
+	};
+
+
+	template<typename... Fields>
+	class soa_vector {
+		static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+	public:
+		typedef std::tuple<Fields...>                                         value;
+		typedef soa_row<Fields...>                                            reference;
+		typedef soa_row<const Fields...>                                      const_reference;
+		typedef soa_vector_iterator<Fields...>                                iterator;
+		typedef soa_vector_iterator<const Fields...>                          const_iterator;
+		typedef soa_vector<Fields...>                                         this_type;
+		template<size_t I>
+		using field = typename std::tuple_element<I, value>::type;
+	public:
+		static const size_t ALIGN = 64;
+	public:
+		soa_vector                     ()                                     noexcept;
+		soa_vector                     (const this_type& other);
+		soa_vector                     (this_type&& other)                    noexcept;
+
+		~soa_vector                    ()                                     noexcept;
+
+		void push_back                 (const value& item);
+		void push_back                 (value&& item);
+		template<typename... Args>
+		reference emplace_back         (Args&&... args);
+
+		void pop_back                  ();
+		void clear                     ()                                     noexcept;
+		void reserve                   (size_t newcap);
+		void swap                      (this_type& other)                     noexcept;
+
+		iterator begin                 ()                                     noexcept;
+		const_iterator begin           ()const                                noexcept;
+		const_iterator cbegin          ()const                                noexcept;
+
+		iterator end                   ()                                     noexcept;
+		const_iterator end             ()const                                noexcept;
+		const_iterator cend            ()const                                noexcept;
+
+		template<size_t I>
+		soa_column<field<I>> column    ()                                     noexcept;
+		template<size_t I>
+		soa_column<const field<I>> column ()const                             noexcept;
+
+		template<size_t I>
+		field<I>* data                 ()                                     noexcept;
+		template<size_t I>
+		const field<I>* data           ()const                                noexcept;
+
+		bool empty                     ()const                                noexcept;
+
+		size_t size                    ()const                                noexcept;
+		size_t max_size                ()const                                noexcept;
+		size_t capacity                ()const                                noexcept;
+
+		reference front                ();
+		reference back                 ();
+		const_reference front          ()const;
+		const_reference back           ()const;
+
+		reference operator[]           (size_t pos);
+		const_reference operator[]     (size_t pos)const;
+
+		this_type& operator=           (const this_type& other);
+		this_type& operator=           (this_type&& other)                    noexcept;
+	protected:
+		size_t                 SIZE;
+		size_t                 CAP;
+
+		std::tuple<Fields*...> elems;
+	private:
+		typedef std::index_sequence_for<Fields...>                            indices;
+	private:
+		void grow                      ();
+		void release                   ()                                     noexcept;
+
+		template<typename Tuple, size_t... I>
+		void construct                 (Tuple&& item, std::index_sequence<I...>);
+		template<typename... Args, size_t... I>
+		void construct_fields          (std::index_sequence<I...>, Args&&... args);
+		template<size_t... I>
+		void destroy                   (size_t pos, std::index_sequence<I...>) noexcept;
+		template<size_t... I>
+		void relocate                  (std::tuple<Fields*...>& dest,
+                                        std::index_sequence<I...>)            noexcept;
+		template<size_t... I>
+		void deallocate                (std::index_sequence<I...>)            noexcept;
+
+		template<typename T>
+		static void relocate           (T* first, T* last, T* dest)           noexcept;
+		template<typename T>
+		static T* allocate             (size_t count);
+		template<typename T>
+		static void deallocate         (T* elems)                             noexcept;
+	};
+
+
+	template<typename T>
+	inline soa_column<T>::soa_column(T* elems, size_t size) noexcept : elems(elems), SIZE(size) {}
+
+
+	template<typename T>
+	inline typename soa_column<T>::iterator soa_column<T>::begin() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T>
+	inline typename soa_column<T>::iterator soa_column<T>::end() const noexcept {
+		return elems + SIZE;
+	}
+
+
+	template<typename T>
+	inline T* soa_column<T>::data() const noexcept {
+		return elems;
+	}
+
+
+	template<typename T>
+	inline bool soa_column<T>::empty() const noexcept {
+		return SIZE == 0;
+	}
+
+
+	template<typename T>
+	inline size_t soa_column<T>::size() const noexcept {
+		return SIZE;
+	}
+
+
+	template<typename T>
+	inline typename soa_column<T>::reference soa_column<T>::operator[](size_t pos) const noexcept {
+		return elems[pos];
+	}
+
+
+	template<typename... Fields>
+	inline soa_vector<Fields...>::soa_vector() noexcept : SIZE(0), CAP(0), elems() {}
+
+
+	template<typename... Fields>
+	inline soa_vector<Fields...>::soa_vector(const this_type& other) : soa_vector() {
+		*this = other;
+	}
+
+
+	template<typename... Fields>
+	inline soa_vector<Fields...>::soa_vector(this_type&& other) noexcept : soa_vector() {
+		swap(other);
+	}
+
+
+	template<typename... Fields>
+	inline soa_vector<Fields...>::~soa_vector() noexcept {
+		release();
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::push_back(const value& item) {
+		if (SIZE == CAP) {
+			value copy(item);
+			grow();
+			construct(std::move(copy), indices());
+			return;
+		}
+		construct(item, indices());
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::push_back(value&& item) {
+		if (SIZE == CAP) {
+			grow();
+		}
+		construct(std::move(item), indices());
+	}
+
+
+	template<typename... Fields>
+	template<typename... Args>
+	inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::emplace_back(Args&&... args) {
+		static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+		if (SIZE == CAP) {
+			value item(std::forward<Args>(args)...);
+			grow();
+			construct(std::move(item), indices());
+		}
+		else {
+			construct_fields(indices(), std::forward<Args>(args)...);
+		}
+		return reference(elems, SIZE - 1);
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::pop_back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		destroy(--SIZE, indices());
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::clear() noexcept {
+		while (SIZE > 0) {
+			destroy(--SIZE, indices());
+		}
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::reserve(size_t newcap) {
+		if (newcap <= CAP) {
+			return;
+		}
+
+		std::tuple<Fields*...> _new(allocate<Fields>(newcap)...);
+		relocate(_new, indices());
+		deallocate(indices());
+		elems = _new;
+		CAP = newcap;
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::swap(this_type& other) noexcept {
+		yo::swap(SIZE, other.SIZE);
+		yo::swap(CAP, other.CAP);
+		elems.swap(other.elems);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::iterator soa_vector<Fields...>::begin() noexcept {
+		return iterator(elems, 0);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::begin() const noexcept {
+		return const_iterator(elems, 0);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::cbegin() const noexcept {
+		return const_iterator(elems, 0);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::iterator soa_vector<Fields...>::end() noexcept {
+		return iterator(elems, SIZE);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::end() const noexcept {
+		return const_iterator(elems, SIZE);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::cend() const noexcept {
+		return const_iterator(elems, SIZE);
+	}
+
+
+	template<typename... Fields>
+	template<size_t I>
+	inline soa_column<typename soa_vector<Fields...>::template field<I>> soa_vector<Fields...>::column() noexcept {
+		return soa_column<field<I>>(std::get<I>(elems), SIZE);
+	}
+
+
+	template<typename... Fields>
+	template<size_t I>
+	inline soa_column<const typename soa_vector<Fields...>::template field<I>> soa_vector<Fields...>::column() const noexcept {
+		return soa_column<const field<I>>(std::get<I>(elems), SIZE);
+	}
+
+
+	template<typename... Fields>
+	template<size_t I>
+	inline typename soa_vector<Fields...>::template field<I>* soa_vector<Fields...>::data() noexcept {
+		return std::get<I>(elems);
+	}
+
+
+	template<typename... Fields>
+	template<size_t I>
+	inline const typename soa_vector<Fields...>::template field<I>* soa_vector<Fields...>::data() const noexcept {
+		return std::get<I>(elems);
+	}
+
+
+	template<typename... Fields>
+	inline bool soa_vector<Fields...>::empty() const noexcept {
+		return SIZE == 0;
+	}
+
+
+	template<typename... Fields>
+	inline size_t soa_vector<Fields...>::size() const noexcept {
+		return SIZE;
+	}
+
+
+	template<typename... Fields>
+	inline size_t soa_vector<Fields...>::max_size() const noexcept {
+		size_t bytes = 0;
+		for (size_t each : { sizeof(Fields)... }) {
+			bytes += each;
+		}
+		return (size_t)-1 / bytes;
+	}
+
+
+	template<typename... Fields>
+	inline size_t soa_vector<Fields...>::capacity() const noexcept {
+		return CAP;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return reference(elems, 0);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return reference(elems, SIZE - 1);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::front() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return const_reference(elems, 0);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::back() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
+		return const_reference(elems, SIZE - 1);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](size_t pos) {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return reference(elems, pos);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::operator[](size_t pos) const {
+		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
+		return const_reference(elems, pos);
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::this_type& soa_vector<Fields...>::operator=(const this_type& other) {
+		if (this != &other) {
+			clear();
+			reserve(other.SIZE);
+			for (size_t i = 0; i < other.SIZE; ++i) {
+				construct(value(other[i].tie()), indices());
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline typename soa_vector<Fields...>::this_type& soa_vector<Fields...>::operator=(this_type&& other) noexcept {
+		if (this != &other) {
+			release();
+			swap(other);
+		}
+		return *this;
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::grow() {
+		reserve(CAP == 0 ? 16 : CAP * 2);
+	}
+
+
+	template<typename... Fields>
+	inline void soa_vector<Fields...>::release() noexcept {
+		clear();
+		deallocate(indices());
+		elems = std::tuple<Fields*...>();
+		CAP = 0;
+	}
+
+
+	template<typename... Fields>
+	template<typename Tuple, size_t... I>
+	inline void soa_vector<Fields...>::construct(Tuple&& item, std::index_sequence<I...>) {
+		(new (std::get<I>(elems) + SIZE) Fields(std::get<I>(std::forward<Tuple>(item))), ...);
+		++SIZE;
+	}
+
+
+	template<typename... Fields>
+	template<typename... Args, size_t... I>
+	inline void soa_vector<Fields...>::construct_fields(std::index_sequence<I...>, Args&&... args) {
+		(new (std::get<I>(elems) + SIZE) Fields(std::forward<Args>(args)), ...);
+		++SIZE;
+	}
+
+
+	template<typename... Fields>
+	template<size_t... I>
+	inline void soa_vector<Fields...>::destroy(size_t pos, std::index_sequence<I...>) noexcept {
+		(std::get<I>(elems)[pos].~Fields(), ...);
+	}
+
+
+	template<typename... Fields>
+	template<size_t... I>
+	inline void soa_vector<Fields...>::relocate(std::tuple<Fields*...>& dest, std::index_sequence<I...>) noexcept {
+		(relocate(std::get<I>(elems), std::get<I>(elems) + SIZE, std::get<I>(dest)), ...);
+	}
+
+
+	template<typename... Fields>
+	template<size_t... I>
+	inline void soa_vector<Fields...>::deallocate(std::index_sequence<I...>) noexcept {
+		(deallocate(std::get<I>(elems)), ...);
+	}
+
+
+	template<typename... Fields>
+	template<typename T>
+	inline void soa_vector<Fields...>::relocate(T* first, T* last, T* dest) noexcept {
+		for (; first != last; ++first, ++dest) {
+			new (dest) T(std::move(*first));
+			first->~T();
+		}
+	}
+
+
+	template<typename... Fields>
+	template<typename T>
+	inline T* soa_vector<Fields...>::allocate(size_t count) {
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T) > ALIGN ? alignof(T) : ALIGN)));
+	}
+
+
+	template<typename... Fields>
+	template<typename T>
+	inline void soa_vector<Fields...>::deallocate(T* elems) noexcept {
+		if (elems != nullptr) {
+			::operator delete(elems, std::align_val_t(alignof(T) > ALIGN ? alignof(T) : ALIGN));
+		}
+	}
+
+
+
+	template<typename... Fields>
+	void swap(soa_vector<Fields...>& left, soa_vector<Fields...>& right) noexcept {
+		left.swap(right);
+	}
+
+
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "utility.h"
+
+
+namespace yo {
+
+
+	template<typename T, size_t N = 1024>
+	class spsc_queue {
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+	public:
+		typedef T                                       value;
+		typedef spsc_queue<T, N>                        this_type;
+	public:
+		spsc_queue                    ()                                     noexcept;
+
+		~spsc_queue                   ()                                     noexcept;
+
+		bool try_push                 (const T& item);
+		bool try_push                 (T&& item);
+		template<typename... Args>
+		bool try_emplace              (Args&&... args);
+		bool try_pop                  (T& item);
+
+		size_t push_batch             (const T* items, size_t count);
+		size_t pop_batch              (T* items, size_t count);
+
+		bool empty                    ()const                                noexcept;
+
+		size_t size                   ()const                                noexcept;
+		size_t capacity               ()const                                noexcept;
+
+		spsc_queue                    (const this_type& other)               = delete;
+		this_type& operator=          (const this_type& other)               = delete;
+	private:
+		T* slot                       (size_t pos)                           noexcept;
+		size_t writable               (size_t wanted)                        noexcept;
+		size_t readable               (size_t wanted)                        noexcept;
+	private:
+		alignas(64) std::atomic<size_t> HEAD;
+		size_t                          cached_tail;
+		alignas(64) std::atomic<size_t> TAIL;
+		size_t                          cached_head;
+		alignas(64) unsigned char       storage[sizeof(T) * N];
+	};
+
+
+	template<typename T, size_t N>
+	inline spsc_queue<T, N>::spsc_queue() noexcept {
+		HEAD.store(0, std::memory_order_relaxed);
+		TAIL.store(0, std::memory_order_relaxed);
+		cached_head = cached_tail = 0;
+	}
+
+
+	template<typename T, size_t N>
+	inline spsc_queue<T, N>::~spsc_queue() noexcept {
+		size_t tail = TAIL.load(std::memory_order_relaxed);
+		for (size_t pos = HEAD.load(std::memory_order_relaxed); pos != tail; ++pos) {
+			slot(pos)->~T();
+		}
+	}
+
+
+	template<typename T, size_t N>
+	inline bool spsc_queue<T, N>::try_push(const T& item) {
+		return try_emplace(item);
+	}
+
+
+	template<typename T, size_t N>
+	inline bool spsc_queue<T, N>::try_push(T&& item) {
+		return try_emplace(std::move(item));
+	}
+
+
+	template<typename T, size_t N>
+	template<typename... Args>
+	inline bool spsc_queue<T, N>::try_emplace(Args&&... args) {
+		if (writable(1) == 0) {
+			return false;
+		}
+
+		size_t tail = TAIL.load(std::memory_order_relaxed);
+		new (slot(tail)) T(std::forward<Args>(args)...);
+		TAIL.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	template<typename T, size_t N>
+	inline bool spsc_queue<T, N>::try_pop(T& item) {
+		if (readable(1) == 0) {
+			return false;
+		}
+
+		size_t head = HEAD.load(std::memory_order_relaxed);
+		T* source = slot(head);
+		item = std::move(*source);
+		source->~T();
+		HEAD.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::push_batch(const T* items, size_t count) {
+		size_t space = writable(count);
+		count = count < space ? count : space;
+
+		size_t tail = TAIL.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < count; ++i) {
+			new (slot(tail + i)) T(items[i]);
+		}
+		TAIL.store(tail + count, std::memory_order_release);
+		return count;
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::pop_batch(T* items, size_t count) {
+		size_t ready = readable(count);
+		count = count < ready ? count : ready;
+
+		size_t head = HEAD.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < count; ++i) {
+			T* source = slot(head + i);
+			items[i] = std::move(*source);
+			source->~T();
+		}
+		HEAD.store(head + count, std::memory_order_release);
+		return count;
+	}
+
+
+	template<typename T, size_t N>
+	inline bool spsc_queue<T, N>::empty() const noexcept {
+		return size() == 0;
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::size() const noexcept {
+		size_t head = HEAD.load(std::memory_order_acquire);
+		size_t tail = TAIL.load(std::memory_order_acquire);
+		return tail - head;
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::capacity() const noexcept {
+		return N;
+	}
+
+
+	template<typename T, size_t N>
+	inline T* spsc_queue<T, N>::slot(size_t pos) noexcept {
+		return reinterpret_cast<T*>(storage) + (pos & (N - 1));
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::writable(size_t wanted) noexcept {
+		size_t tail = TAIL.load(std::memory_order_relaxed);
+		if (N - (tail - cached_head) < wanted) {
+			cached_head = HEAD.load(std::memory_order_acquire);
+		}
+		return N - (tail - cached_head);
+	}
+
+
+	template<typename T, size_t N>
+	inline size_t spsc_queue<T, N>::readable(size_t wanted) noexcept {
+		size_t head = HEAD.load(std::memory_order_relaxed);
+		if (cached_tail - head < wanted) {
+			cached_tail = TAIL.load(std::memory_order_acquire);
+		}
+		return cached_tail - head;
+	}
+
+
+}
\ No newline at end of file
@@ -7,42 +7,50 @@
 
 
 #include <initializer_list>
+#include <utility>
 
 #include "utility.h"
-#include "iterators/reverse_iterator.h"
+#include "small_vector.h"
 
 
 namespace yo {
 
 
-	template<typename T, size_t MAX_SIZE = 100>
+	template<typename T, typename Container = small_vector<T>>
 	class stack {
 	public:
 		typedef T                                                                 value;
-		typedef T*                                                                pointer;
-		typedef const T*                                                          const_pointer;
-		typedef const T*                                                          iterator;
 		typedef T&                                                                reference;
 		typedef const T&                                                          const_reference;
-		typedef reverse_iterator<value, pointer, const_reference, iterator>       reverse_iterator;
+		typedef const T*                                                          const_pointer;
+		typedef typename Container::const_iterator                                iterator;
+		typedef typename Container::const_reverse_iterator                        reverse_iterator;
+		typedef Container                                                         container_type;
+		typedef stack<T, Container>                                               this_type;
 	public:
 		stack                         ()                                          noexcept;
-		stack                         (const std::initializer_list<value>& list);
-		stack                         (const stack<T, MAX_SIZE>& other)           noexcept;
+		stack                         (const std::initializer_list<value>& items);
+		stack                         (const this_type& other);
+		stack                         (this_type&& other)                         noexcept;
 		stack                         (const value& item);
-		template<typename Container = stack<T, MAX_SIZE>>
-		stack                         (const Container& other);
+		template<typename Other = this_type>
+		stack                         (const Other& other);
 
 		void push                     (const T& item);
+		void push                     (T&& item);
 		reference push                ();
+		template<typename... Args>
+		reference emplace             (Args&&... args);
 
-		void swap                     (stack<T, MAX_SIZE>& other)                 noexcept;
+		void swap                     (this_type& other)                          noexcept;
 		void clear                    ()                                          noexcept;
+		void reserve                  (size_t count);
 
-		const_reference pop           ();
+		void pop                      ();
+		bool pop                      (T& item);
 
-		reference top                 ()                                          noexcept;
-		const_reference top           ()const                                     noexcept;
+		reference top                 ();
+		const_reference top           ()const;
 
 		const_pointer data            ()const                                     noexcept;
 
@@ -54,201 +62,235 @@ namespace yo {
 
 		size_t size                   ()const                                     noexcept;
 		size_t max_size               ()const                                     noexcept;
+		size_t capacity               ()const                                     noexcept;
 
 		bool empty                    ()const                                     noexcept;
 
-		stack<T, MAX_SIZE>& operator= (const stack<T, MAX_SIZE>& other)           noexcept;
-		template<typename Container = stack<T, MAX_SIZE>>
-		stack<T, MAX_SIZE>& operator= (const Container& other);
+		this_type& operator=          (const this_type& other);
+		this_type& operator=          (this_type&& other)                         noexcept;
+		template<typename Other = this_type>
+		this_type& operator=          (const Other& other);
 	protected:
-		size_t  SIZE;
-		value   elems[MAX_SIZE == 0 ? 1 : MAX_SIZE];
+		Container elems;
 	};
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline stack<T, MAX_SIZE>::stack() noexcept {
-		SIZE = 0;
-	}
+	template<typename T, typename Container>
+	inline stack<T, Container>::stack() noexcept {}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline stack<T, MAX_SIZE>::stack(const std::initializer_list<value>& list) : stack() {
-		YO_ASSERT_THROW(list.size() > MAX_SIZE, "Out of bounds");
-		for (const auto& item : list) {
-			elems[SIZE++] = item;
+	template<typename T, typename Container>
+	inline stack<T, Container>::stack(const std::initializer_list<value>& items) : stack() {
+		elems.reserve(items.size());
+		for (const auto& item : items) {
+			elems.push_back(item);
 		}
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline stack<T, MAX_SIZE>::stack(const stack<T, MAX_SIZE>& other) noexcept : stack() {
+	template<typename T, typename Container>
+	inline stack<T, Container>::stack(const this_type& other) : elems(other.elems) {}
+
+
+	template<typename T, typename Container>
+	inline stack<T, Container>::stack(this_type&& other) noexcept : elems(std::move(other.elems)) {}
+
+
+	template<typename T, typename Container>
+	template<typename Other>
+	inline stack<T, Container>::stack(const Other& other) : stack() {
 		*this = other;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	template<typename Container>
-	inline stack<T, MAX_SIZE>::stack(const Container& other) {
-		YO_ASSERT_THROW(other.size() > MAX_SIZE, "Out of bounds");
-		*this = other;
+	template<typename T, typename Container>
+	inline stack<T, Container>::stack(const value& item) : stack() {
+		elems.push_back(item);
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline stack<T, MAX_SIZE>::stack(const value& item)	: stack() {
-		elems[SIZE++] = item;
+	template<typename T, typename Container>
+	inline void stack<T, Container>::push(const value& item) {
+		elems.push_back(item);
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline void stack<T, MAX_SIZE>::push(const value& item) {
-		YO_ASSERT_THROW(size() >= MAX_SIZE, "Out of bounds");
-		elems[SIZE++] = item;
+	template<typename T, typename Container>
+	inline void stack<T, Container>::push(value&& item) {
+		elems.push_back(std::move(item));
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::reference yo::stack<T, MAX_SIZE>::push() {
-		YO_ASSERT_THROW(size() >= MAX_SIZE, "Out of bounds");
-		return elems[SIZE++];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::reference stack<T, Container>::push() {
+		return elems.emplace_back();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline void stack<T, MAX_SIZE>::swap(stack<T, MAX_SIZE>& other) noexcept {
-		size_t length = size() > other.size() ? size() : other.size();
-		for (size_t i = 0; i < length; ++i) {
-			yo::swap(elems[i], other.elems[i]);
+	template<typename T, typename Container>
+	template<typename... Args>
+	inline typename stack<T, Container>::reference stack<T, Container>::emplace(Args&&... args) {
+		return elems.emplace_back(std::forward<Args>(args)...);
+	}
+
+
+	template<typename T, typename Container>
+	inline void stack<T, Container>::swap(this_type& other) noexcept {
+		elems.swap(other.elems);
+	}
+
+
+	template<typename T, typename Container>
+	inline void stack<T, Container>::clear() noexcept {
+		elems.clear();
+	}
+
+
+	template<typename T, typename Container>
+	inline void stack<T, Container>::reserve(size_t count) {
+		elems.reserve(count);
+	}
+
+
+	template<typename T, typename Container>
+	inline void stack<T, Container>::pop() {
+		YO_ASSERT_THROW(empty(), "Empty stack");
+		elems.pop_back();
+	}
+
+
+	template<typename T, typename Container>
+	inline bool stack<T, Container>::pop(value& item) {
+		if (empty()) {
+			return false;
 		}
-		yo::swap(SIZE, other.SIZE);
+		item = std::move(elems.back());
+		elems.pop_back();
+		return true;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline void stack<T, MAX_SIZE>::clear() noexcept {
-		SIZE = 0;
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::reference stack<T, Container>::top() {
+		YO_ASSERT_THROW(empty(), "Empty stack");
+		return elems.back();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::const_reference yo::stack<T, MAX_SIZE>::pop() {
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::const_reference stack<T, Container>::top() const {
 		YO_ASSERT_THROW(empty(), "Empty stack");
-		return elems[--SIZE];
+		return elems.back();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::reference yo::stack<T, MAX_SIZE>::top() noexcept {
-		return elems[SIZE - 1];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::const_pointer stack<T, Container>::data() const noexcept {
+		return elems.data();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::const_reference yo::stack<T, MAX_SIZE>::top() const noexcept {
-		return elems[SIZE - 1];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::iterator stack<T, Container>::begin() const noexcept {
+		return elems.begin();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::const_pointer stack<T, MAX_SIZE>::data() const noexcept {
-		return &elems[0];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::iterator stack<T, Container>::end() const noexcept {
+		return elems.end();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::iterator stack<T, MAX_SIZE>::begin() const noexcept {
-		return &elems[0];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::reverse_iterator stack<T, Container>::rbegin() const noexcept	{
+		return elems.rbegin();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::iterator stack<T, MAX_SIZE>::end() const noexcept {
-		return &elems[SIZE];
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::reverse_iterator stack<T, Container>::rend() const noexcept {
+		return elems.rend();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::reverse_iterator stack<T, MAX_SIZE>::rbegin() const noexcept	{
-		return &elems[SIZE];
+	template<typename T, typename Container>
+	inline size_t stack<T, Container>::size() const noexcept {
+		return elems.size();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline typename stack<T, MAX_SIZE>::reverse_iterator stack<T, MAX_SIZE>::rend() const noexcept {
-		return &elems[0];
+	template<typename T, typename Container>
+	inline size_t stack<T, Container>::max_size() const noexcept {
+		return elems.max_size();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline size_t stack<T, MAX_SIZE>::size() const noexcept {
-		return SIZE;
+	template<typename T, typename Container>
+	inline size_t stack<T, Container>::capacity() const noexcept {
+		return elems.capacity();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline size_t stack<T, MAX_SIZE>::max_size() const noexcept {
-		return MAX_SIZE;
+	template<typename T, typename Container>
+	inline bool stack<T, Container>::empty() const noexcept {
+		return elems.empty();
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool stack<T, MAX_SIZE>::empty() const noexcept {
-		return SIZE == 0;
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::this_type& stack<T, Container>::operator=(const this_type& other) {
+		elems = other.elems;
+		return *this;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline stack<T, MAX_SIZE>& stack<T, MAX_SIZE>::operator=(const stack<T, MAX_SIZE>& other) noexcept {
-		for (SIZE = 0; SIZE < other.size(); ++SIZE) {
-			elems[SIZE] = other.elems[SIZE];
-		}
+	template<typename T, typename Container>
+	inline typename stack<T, Container>::this_type& stack<T, Container>::operator=(this_type&& other) noexcept {
+		elems = std::move(other.elems);
 		return *this;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	template<typename Container>
-	inline stack<T, MAX_SIZE>& stack<T, MAX_SIZE>::operator=(const Container& other) {
-		YO_ASSERT_THROW(other.size() > MAX_SIZE, "Out of bounds");
-		SIZE = 0;
+	template<typename T, typename Container>
+	template<typename Other>
+	inline typename stack<T, Container>::this_type& stack<T, Container>::operator=(const Other& other) {
+		elems.clear();
+		elems.reserve(other.size());
 		for (const auto& item : other) {
-			elems[SIZE++] = item;
+			elems.push_back(item);
 		}
 		return *this;
 	}
 
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator==(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
-		if (yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 0) {
-			return left.size() == right.size();
-		}
-		return false;
+	template<typename T, typename Container>
+	inline bool operator==(const stack<T, Container>& left, const stack<T, Container>& right) {
+		return left.size() == right.size() && yo::equal(left.begin(), left.end(), right.begin());
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator!=(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	inline bool operator!=(const stack<T, Container>& left, const stack<T, Container>& right) {
 		return !(left == right);
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator>(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	inline bool operator>(const stack<T, Container>& left, const stack<T, Container>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 1;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator<(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	inline bool operator<(const stack<T, Container>& left, const stack<T, Container>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == -1;
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator>=(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	inline bool operator>=(const stack<T, Container>& left, const stack<T, Container>& right) {
 		short result = yo::compare(left.begin(), right.begin(), left.end(), right.end());
 		if (result == 0) {
 			return left.size() == right.size();
@@ -257,8 +299,8 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	inline bool operator<=(const stack<T, MAX_SIZE>& left, const stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	inline bool operator<=(const stack<T, Container>& left, const stack<T, Container>& right) {
 		short result = yo::compare(left.begin(), right.begin(), left.end(), right.end());
 		if (result == 0) {
 			return left.size() == right.size();
@@ -267,8 +309,8 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t MAX_SIZE>
-	void swap(stack<T, MAX_SIZE>& left, stack<T, MAX_SIZE>& right) {
+	template<typename T, typename Container>
+	void swap(stack<T, Container>& left, stack<T, Container>& right) noexcept {
 		left.swap(right);
 	}
 
@@ -17,6 +17,9 @@ namespace yo {
 		string                          (const char* str)                     noexcept;
 		string                          (size_t count, const char& c)         noexcept;
 
+		void append                     (const char* str, size_t count)       noexcept;
+		char* append_uninitialized      (size_t count)                        noexcept;
+
 		bool starts_with                (const string& str)const              noexcept;
 		bool ends_with                  (const string& str)const              noexcept;
 
@@ -55,6 +58,29 @@ namespace yo {
 	}
 
 
+	inline void string::append(const char* str, size_t count) noexcept {
+		size_t offset = str - elems;
+		bool inside = str >= elems && str < elems + SIZE;
+		char* out = append_uninitialized(count);
+		if (inside) {
+			str = elems + offset;
+		}
+		for (size_t i = 0; i < count; ++i) {
+			out[i] = str[i];
+		}
+	}
+
+
+	inline char* string::append_uninitialized(size_t count) noexcept {
+		if (SIZE + count > CAP) {
+			reserve(SIZE + count > CAP * 2 ? SIZE + count : CAP * 2);
+		}
+		char* result = elems + SIZE;
+		SIZE += count;
+		return result;
+	}
+
+
 	inline bool string::starts_with(const string& str) const noexcept {
 		if (SIZE >= str.size()) {
 			return yo::compare(begin(), str.begin(), end(), str.end()) == 0;
@@ -87,15 +113,13 @@ namespace yo {
 
 	inline string string::operator+(const string& str) const noexcept {
 		string result = *this;
-		for (const auto& item : str) {
-			result.push_back(item);
-		}
+		result.append(str.data(), str.size());
 		return result;
 	}
 
 
 	inline string string::operator+=(const string& str) noexcept {
-		*this = *this + str;
+		append(str.data(), str.size());
 		return *this;
 	}
 
@@ -0,0 +1,343 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+#ifndef YO_STRING_POOL_BLOCK_SIZE
+#define YO_STRING_POOL_BLOCK_SIZE 65536
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#include "hashtable.h"
+#include "string.h"
+#include "vector.h"
+
+
+namespace yo {
+
+
+	class symbol {
+	public:
+		static const uint32_t npos = (uint32_t)-1;
+	public:
+		symbol                    ()                          noexcept;
+		explicit symbol           (uint32_t id)               noexcept;
+
+		uint32_t id               ()const                     noexcept;
+		size_t hash               ()const                     noexcept;
+
+		bool valid                ()const                     noexcept;
+
+		bool operator==           (const symbol& other)const  noexcept;
+		bool operator!=           (const symbol& other)const  noexcept;
+		bool operator<            (const symbol& other)const  noexcept;
+	private:
+		uint32_t ID;
+	};
+
+
+	struct null_mutex {
+		void lock()   noexcept {}
+		void unlock() noexcept {}
+	};
+
+
+	template<typename Mutex = null_mutex>
+	class basic_string_pool {
+	public:
+		typedef basic_string_pool<Mutex>                       this_type;
+	public:
+		basic_string_pool         ()                                     noexcept;
+
+		~basic_string_pool        ()                                     noexcept;
+
+		symbol intern             (const char* str)                      noexcept;
+		symbol intern             (const char* str, size_t count)        noexcept;
+		symbol intern             (const string& str)                    noexcept;
+
+		symbol find               (const char* str)const                 noexcept;
+		symbol find               (const char* str, size_t count)const   noexcept;
+		symbol find               (const string& str)const               noexcept;
+
+		const char* c_str         (symbol sym)const;
+		size_t length             (symbol sym)const;
+		string str                (symbol sym)const;
+
+		void clear                ()                                     noexcept;
+
+		bool empty                ()const                                noexcept;
+
+		size_t size               ()const                                noexcept;
+		size_t memory             ()const                                noexcept;
+
+		basic_string_pool         (const this_type& other)               = delete;
+		this_type& operator=      (const this_type& other)               = delete;
+	private:
+		struct Entry {
+			const char* str;
+			size_t      length;
+			size_t      hash;
+			uint32_t    next;
+		};
+	private:
+		uint32_t lookup           (const char* str, size_t count,
+                                   size_t hash)const                     noexcept;
+		const char* store         (const char* str, size_t count)        noexcept;
+		const Entry& entry        (symbol sym)const;
+
+		static size_t hasher      (const char* str, size_t count)        noexcept;
+	private:
+		hashtable<size_t, uint32_t> index;
+		vector<Entry>               entries;
+		vector<char*>               blocks;
+		char*                       cursor;
+		size_t                      space;
+		size_t                      bytes;
+		mutable Mutex               mutex;
+	};
+
+
+	typedef basic_string_pool<null_mutex> string_pool;
+	typedef basic_string_pool<std::mutex> concurrent_string_pool;
+
+
+	inline symbol::symbol() noexcept {
+		ID = npos;
+	}
+
+
+	inline symbol::symbol(uint32_t id) noexcept {
+		ID = id;
+	}
+
+
+	inline uint32_t symbol::id() const noexcept {
+		return ID;
+	}
+
+
+	inline size_t symbol::hash() const noexcept {
+		return ID;
+	}
+
+
+	inline bool symbol::valid() const noexcept {
+		return ID != npos;
+	}
+
+
+	inline bool symbol::operator==(const symbol& other) const noexcept {
+		return ID == other.ID;
+	}
+
+
+	inline bool symbol::operator!=(const symbol& other) const noexcept {
+		return ID != other.ID;
+	}
+
+
+	inline bool symbol::operator<(const symbol& other) const noexcept {
+		return ID < other.ID;
+	}
+
+
+	template<typename Mutex>
+	inline basic_string_pool<Mutex>::basic_string_pool() noexcept {
+		cursor = nullptr;
+		space = bytes = 0;
+	}
+
+
+	template<typename Mutex>
+	inline basic_string_pool<Mutex>::~basic_string_pool() noexcept {
+		for (char* block : blocks) {
+			delete[] block;
+		}
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::intern(const char* str) noexcept {
+		return intern(str, std::strlen(str));
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::intern(const char* str, size_t count) noexcept {
+		size_t hash = hasher(str, count);
+		std::lock_guard<Mutex> guard(mutex);
+
+		uint32_t id = lookup(str, count, hash);
+		if (id != symbol::npos) {
+			return symbol(id);
+		}
+
+		id = (uint32_t)entries.size();
+		Entry& item = entries.push_back();
+		item.str = store(str, count);
+		item.length = count;
+		item.hash = hash;
+		item.next = symbol::npos;
+
+		auto head = index.find(hash);
+		if (head == index.end()) {
+			index.insert({ hash, id });
+		}
+		else {
+			item.next = head->second;
+			head->second = id;
+		}
+
+		return symbol(id);
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::intern(const string& str) noexcept {
+		return intern(str.data(), str.size());
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::find(const char* str) const noexcept {
+		return find(str, std::strlen(str));
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::find(const char* str, size_t count) const noexcept {
+		size_t hash = hasher(str, count);
+		std::lock_guard<Mutex> guard(mutex);
+		return symbol(lookup(str, count, hash));
+	}
+
+
+	template<typename Mutex>
+	inline symbol basic_string_pool<Mutex>::find(const string& str) const noexcept {
+		return find(str.data(), str.size());
+	}
+
+
+	template<typename Mutex>
+	inline const char* basic_string_pool<Mutex>::c_str(symbol sym) const {
+		std::lock_guard<Mutex> guard(mutex);
+		return entry(sym).str;
+	}
+
+
+	template<typename Mutex>
+	inline size_t basic_string_pool<Mutex>::length(symbol sym) const {
+		std::lock_guard<Mutex> guard(mutex);
+		return entry(sym).length;
+	}
+
+
+	template<typename Mutex>
+	inline string basic_string_pool<Mutex>::str(symbol sym) const {
+		std::lock_guard<Mutex> guard(mutex);
+		const Entry& item = entry(sym);
+
+		string result;
+		result.resize(item.length);
+		std::memcpy(result.data(), item.str, item.length);
+		return result;
+	}
+
+
+	template<typename Mutex>
+	inline void basic_string_pool<Mutex>::clear() noexcept {
+		std::lock_guard<Mutex> guard(mutex);
+		for (char* block : blocks) {
+			delete[] block;
+		}
+		blocks.clear();
+		entries.clear();
+		index.clear();
+		cursor = nullptr;
+		space = bytes = 0;
+	}
+
+
+	template<typename Mutex>
+	inline bool basic_string_pool<Mutex>::empty() const noexcept {
+		return size() == 0;
+	}
+
+
+	template<typename Mutex>
+	inline size_t basic_string_pool<Mutex>::size() const noexcept {
+		std::lock_guard<Mutex> guard(mutex);
+		return entries.size();
+	}
+
+
+	template<typename Mutex>
+	inline size_t basic_string_pool<Mutex>::memory() const noexcept {
+		std::lock_guard<Mutex> guard(mutex);
+		return bytes;
+	}
+
+
+	template<typename Mutex>
+	inline uint32_t basic_string_pool<Mutex>::lookup(const char* str, size_t count, size_t hash) const noexcept {
+		auto head = index.find(hash);
+		if (head == index.end()) {
+			return symbol::npos;
+		}
+
+		uint32_t id = head->second;
+		while (id != symbol::npos) {
+			const Entry& item = entries[id];
+			if (item.hash == hash && item.length == count && std::memcmp(item.str, str, count) == 0) {
+				return id;
+			}
+			id = item.next;
+		}
+
+		return symbol::npos;
+	}
+
+
+	template<typename Mutex>
+	inline const char* basic_string_pool<Mutex>::store(const char* str, size_t count) noexcept {
+		if (count + 1 > space) {
+			size_t block = count + 1 > YO_STRING_POOL_BLOCK_SIZE ? count + 1 : YO_STRING_POOL_BLOCK_SIZE;
+			blocks.push_back(cursor = new char[block]);
+			space = block;
+			bytes += block;
+		}
+
+		char* result = cursor;
+		std::memcpy(result, str, count);
+		result[count] = '\0';
+
+		cursor += count + 1;
+		space -= count + 1;
+		return result;
+	}
+
+
+	template<typename Mutex>
+	inline const typename basic_string_pool<Mutex>::Entry& basic_string_pool<Mutex>::entry(symbol sym) const {
+		YO_ASSERT_THROW(sym.id() >= entries.size(), "Unknown symbol");
+		return entries[sym.id()];
+	}
+
+
+	template<typename Mutex>
+	inline size_t basic_string_pool<Mutex>::hasher(const char* str, size_t count) noexcept {
+		uint64_t hash = 14695981039346656037ull;
+		while (count-- > 0) {
+			hash ^= (unsigned char)*str++;
+			hash *= 1099511628211ull;
+		}
+		return (size_t)(hash ^ (hash >> 32));
+	}
+
+
+}
\ No newline at end of file
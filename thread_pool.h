@@ -0,0 +1,285 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "utility.h"
+#include "vector.h"
+#include "ws_deque.h"
+#include "mpmc_queue.h"
+#include "blocking_queue.h"
+
+
+namespace yo {
+
+
+	class thread_pool {
+	public:
+		typedef std::function<void()>                   task;
+	public:
+		thread_pool                   (size_t threads = 0);
+
+		~thread_pool                  ()                                     noexcept;
+
+		template<typename F>
+		void submit                   (F&& function);
+
+		bool run_one                  ();
+
+		size_t size                   ()const                                noexcept;
+
+		thread_pool                   (const thread_pool& other)             = delete;
+		thread_pool& operator=        (const thread_pool& other)             = delete;
+	private:
+		struct Worker {
+			ws_deque<task*> tasks;
+			std::thread     thread;
+		};
+	private:
+		static const size_t npos = (size_t)-1;
+	private:
+		void work                     (size_t index);
+		bool find                     (size_t index, task*& found);
+		void wake                     ()                                     noexcept;
+		size_t self                   ()const                                noexcept;
+
+		static thread_pool*& current_pool ()                                 noexcept;
+		static size_t& current_index  ()                                     noexcept;
+	private:
+		vector<Worker*>                   workers;
+		mpmc_queue<task*>                 injected;
+		std::atomic<bool>                 stopping;
+		alignas(64) std::atomic<uint32_t> epoch;
+		std::atomic<uint32_t>             sleepers;
+	};
+
+
+	class task_group {
+	public:
+		task_group                    (thread_pool& pool)                    noexcept;
+
+		~task_group                   ()                                     noexcept;
+
+		template<typename F>
+		void run                      (F&& function);
+
+		void wait                     ();
+
+		task_group                    (const task_group& other)              = delete;
+		task_group& operator=         (const task_group& other)              = delete;
+	private:
+		void drain                    ()                                     noexcept;
+	private:
+		thread_pool&        pool;
+		std::atomic<size_t> pending;
+		std::atomic<bool>   failed;
+		std::exception_ptr  error;
+	};
+
+
+	inline thread_pool::thread_pool(size_t threads) : injected(4096) {
+		if (threads == 0) {
+			threads = std::thread::hardware_concurrency();
+			threads = threads == 0 ? 1 : threads;
+		}
+
+		stopping.store(false, std::memory_order_relaxed);
+		epoch.store(0, std::memory_order_relaxed);
+		sleepers.store(0, std::memory_order_relaxed);
+
+		for (size_t i = 0; i < threads; ++i) {
+			workers.push_back(new Worker());
+		}
+		for (size_t i = 0; i < threads; ++i) {
+			workers[i]->thread = std::thread(&thread_pool::work, this, i);
+		}
+	}
+
+
+	inline thread_pool::~thread_pool() noexcept {
+		stopping.store(true, std::memory_order_seq_cst);
+		epoch.fetch_add(1, std::memory_order_seq_cst);
+		atomic_notify_all(epoch);
+
+		for (size_t i = 0; i < workers.size(); ++i) {
+			workers[i]->thread.join();
+		}
+
+		task* pending;
+		for (size_t i = 0; i < workers.size(); ++i) {
+			while (workers[i]->tasks.pop(pending)) {
+				delete pending;
+			}
+			delete workers[i];
+		}
+		while (injected.try_pop(pending)) {
+			delete pending;
+		}
+	}
+
+
+	template<typename F>
+	inline void thread_pool::submit(F&& function) {
+		task* item = new task(std::forward<F>(function));
+
+		size_t index = self();
+		if (index != npos) {
+			workers[index]->tasks.push(item);
+		}
+		else {
+			while (!injected.try_push(item)) {
+				if (!run_one()) {
+					std::this_thread::yield();
+				}
+			}
+		}
+		wake();
+	}
+
+
+	inline bool thread_pool::run_one() {
+		task* item;
+		if (!find(self(), item)) {
+			return false;
+		}
+		(*item)();
+		delete item;
+		return true;
+	}
+
+
+	inline size_t thread_pool::size() const noexcept {
+		return workers.size();
+	}
+
+
+	inline void thread_pool::work(size_t index) {
+		current_pool() = this;
+		current_index() = index;
+
+		task* item;
+		while (true) {
+			if (find(index, item)) {
+				(*item)();
+				delete item;
+				continue;
+			}
+
+			uint32_t seen = epoch.load(std::memory_order_seq_cst);
+			if (stopping.load(std::memory_order_seq_cst)) {
+				break;
+			}
+			if (find(index, item)) {
+				(*item)();
+				delete item;
+				continue;
+			}
+
+			sleepers.fetch_add(1, std::memory_order_seq_cst);
+			atomic_wait(epoch, seen);
+			sleepers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+
+		current_pool() = nullptr;
+	}
+
+
+	inline bool thread_pool::find(size_t index, task*& found) {
+		if (index != npos && workers[index]->tasks.pop(found)) {
+			return true;
+		}
+		if (injected.try_pop(found)) {
+			return true;
+		}
+
+		size_t count = workers.size();
+		size_t start = (size_t)thread_random_engine().bounded(count);
+		for (size_t i = 0; i < count; ++i) {
+			size_t victim = (start + i) % count;
+			if (victim != index && workers[victim]->tasks.steal(found)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	inline void thread_pool::wake() noexcept {
+		epoch.fetch_add(1, std::memory_order_seq_cst);
+		if (sleepers.load(std::memory_order_seq_cst) != 0) {
+			atomic_notify_one(epoch);
+		}
+	}
+
+
+	inline size_t thread_pool::self() const noexcept {
+		return current_pool() == this ? current_index() : npos;
+	}
+
+
+	inline thread_pool*& thread_pool::current_pool() noexcept {
+		static thread_local thread_pool* pool = nullptr;
+		return pool;
+	}
+
+
+	inline size_t& thread_pool::current_index() noexcept {
+		static thread_local size_t index = npos;
+		return index;
+	}
+
+
+	inline task_group::task_group(thread_pool& pool) noexcept : pool(pool) {
+		pending.store(0, std::memory_order_relaxed);
+		failed.store(false, std::memory_order_relaxed);
+	}
+
+
+	inline task_group::~task_group() noexcept {
+		drain();
+	}
+
+
+	template<typename F>
+	inline void task_group::run(F&& function) {
+		pending.fetch_add(1, std::memory_order_relaxed);
+		pool.submit([this, function = std::forward<F>(function)]() mutable {
+			try {
+				function();
+			}
+			catch (...) {
+				if (!failed.exchange(true, std::memory_order_relaxed)) {
+					error = std::current_exception();
+				}
+			}
+			pending.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+
+	inline void task_group::wait() {
+		drain();
+		if (error != nullptr) {
+			std::exception_ptr thrown = error;
+			error = nullptr;
+			failed.store(false, std::memory_order_relaxed);
+			std::rethrow_exception(thrown);
+		}
+	}
+
+
+	inline void task_group::drain() noexcept {
+		while (pending.load(std::memory_order_acquire) != 0) {
+			if (!pool.run_one()) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+
+}
\ No newline at end of file
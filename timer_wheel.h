@@ -0,0 +1,172 @@
+#pragma once
+
+
+#include <cstdint>
+
+#include "intrusive_list.h"
+#include "vector.h"
+
+
+namespace yo {
+
+
+	struct timer {
+		list_hook hook;
+		uint64_t  deadline;
+
+		timer() noexcept
+		:deadline(0) {}
+
+		bool scheduled() const noexcept
+		{ return hook.linked(); }
+	};
+
+
+	class timer_wheel {
+	public:
+		typedef intrusive_list<timer, &timer::hook>      bucket;
+		typedef timer*                                    handle;
+	public:
+		timer_wheel                   (uint64_t now = 0)                      noexcept;
+
+		void schedule                 (timer& item, uint64_t deadline)        noexcept;
+		void schedule_after           (timer& item, uint64_t delay)           noexcept;
+		bool cancel                   (timer& item)                           noexcept;
+
+		size_t advance                (uint64_t to, vector<handle>& expired)  noexcept;
+
+		uint64_t now                  ()const                                 noexcept;
+
+		size_t size                   ()const                                 noexcept;
+
+		bool empty                    ()const                                 noexcept;
+
+		timer_wheel                   (const timer_wheel& other)              = delete;
+		timer_wheel& operator=        (const timer_wheel& other)              = delete;
+	public:
+		static const size_t LEVELS = 4;
+		static const size_t BITS   = 8;
+		static const size_t SLOTS  = (size_t)1 << BITS;
+	private:
+		void insert                   (timer& item, uint64_t earliest)        noexcept;
+		void cascade                  (size_t level)                          noexcept;
+		static size_t slot            (uint64_t tick, size_t level)           noexcept;
+	private:
+		uint64_t current;
+		bucket   wheel[LEVELS][SLOTS];
+	};
+
+
+	inline timer_wheel::timer_wheel(uint64_t now) noexcept {
+		current = now;
+	}
+
+
+	inline void timer_wheel::schedule(timer& item, uint64_t deadline) noexcept {
+		item.hook.unlink();
+		item.deadline = deadline;
+		insert(item, current + 1);
+	}
+
+
+	inline void timer_wheel::schedule_after(timer& item, uint64_t delay) noexcept {
+		schedule(item, current + delay);
+	}
+
+
+	inline bool timer_wheel::cancel(timer& item) noexcept {
+		if (!item.scheduled()) {
+			return false;
+		}
+		item.hook.unlink();
+		return true;
+	}
+
+
+	inline size_t timer_wheel::advance(uint64_t to, vector<handle>& expired) noexcept {
+		size_t count = 0;
+		while (current < to) {
+			++current;
+
+			size_t level = LEVELS - 1;
+			while (level > 0 && (current & (((uint64_t)1 << (level * BITS)) - 1)) != 0) {
+				--level;
+			}
+			for (; level > 0; --level) {
+				cascade(level);
+			}
+
+			bucket& due = wheel[0][slot(current, 0)];
+			while (!due.empty()) {
+				timer& item = due.front();
+				due.pop_front();
+				expired.push_back(&item);
+				++count;
+			}
+		}
+		return count;
+	}
+
+
+	inline uint64_t timer_wheel::now() const noexcept {
+		return current;
+	}
+
+
+	inline size_t timer_wheel::size() const noexcept {
+		size_t count = 0;
+		for (size_t level = 0; level < LEVELS; ++level) {
+			for (size_t i = 0; i < SLOTS; ++i) {
+				count += wheel[level][i].size();
+			}
+		}
+		return count;
+	}
+
+
+	inline bool timer_wheel::empty() const noexcept {
+		for (size_t level = 0; level < LEVELS; ++level) {
+			for (size_t i = 0; i < SLOTS; ++i) {
+				if (!wheel[level][i].empty()) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
+	inline void timer_wheel::insert(timer& item, uint64_t earliest) noexcept {
+		uint64_t target = item.deadline > earliest ? item.deadline : earliest;
+		uint64_t delta = target - current;
+
+		size_t level = 0;
+		while (level < LEVELS - 1 && delta >= ((uint64_t)1 << ((level + 1) * BITS))) {
+			++level;
+		}
+
+		uint64_t span = (uint64_t)1 << (LEVELS * BITS);
+		if (delta >= span) {
+			target = current + span - 1;
+		}
+		wheel[level][slot(target, level)].push_back(item);
+	}
+
+
+	inline void timer_wheel::cascade(size_t level) noexcept {
+		bucket pending;
+		pending.swap(wheel[level][slot(current, level)]);
+		while (!pending.empty()) {
+			timer& item = pending.front();
+			pending.pop_front();
+			insert(item, current);
+		}
+	}
+
+
+	inline size_t timer_wheel::slot(uint64_t tick, size_t level) noexcept {
+		return (size_t)(tick >> (level * BITS)) & (SLOTS - 1);
+	}
+
+
+}
\ No newline at end of file
@@ -0,0 +1,661 @@
+#pragma once
+
+
+#ifndef YO_ASSERT_THROW
+#define YO_ASSERT_THROW(statement, message) if(statement == true) throw message
+#endif
+
+
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include "utility.h"
+#include "iterators/unrolled_list_iterator.h"
+#include "iterators/reverse_iterator.h"
+
+
+namespace yo {
+
+
+	struct UnrolledLink {
+		UnrolledLink* next;
+		UnrolledLink* prev;
+		size_t        count;
+
+		UnrolledLink() noexcept
+		{ next = prev = this; count = 0; }
+	};
+
+
+	template<typename T, size_t ChunkSize>
+	struct UnrolledNode : UnrolledLink {
+		alignas(T) unsigned char storage[sizeof(T) * ChunkSize];
+
+		T* items() noexcept
+		{ return reinterpret_cast<T*>(storage); }
+
+		const T* items() const noexcept
+		{ return reinterpret_cast<const T*>(storage); }
+	};
+
+
+	template<typename T, size_t ChunkSize = (sizeof(T) >= 256 ? 4 : 1024 / sizeof(T))>
+	class unrolled_list {
+	public:
+		typedef T                                                                      value;
+		typedef T&                                                                     reference;
+		typedef const T&                                                               const_reference;
+		typedef UnrolledLink                                                           Link;
+		typedef UnrolledNode<T, ChunkSize>                                             Node;
+		typedef Link*                                                                  pointer_type;
+		typedef unrolled_list<T, ChunkSize>                                            this_type;
+		typedef unrolled_list_iterator<T, Link, Node, T&>                              iterator;
+		typedef unrolled_list_iterator<const T, Link, Node, const T&>                  const_iterator;
+		typedef reverse_iterator<T, const T*, const T&, const_iterator>                const_reverse_iterator;
+		typedef reverse_iterator<T, T*, T&, iterator>                                  reverse_iterator;
+	public:
+		unrolled_list                  ()                                              noexcept;
+		unrolled_list                  (const std::initializer_list<T>& items)         noexcept;
+		unrolled_list                  (size_t count, const T& item)                   noexcept;
+		unrolled_list                  (const T& item)                                 noexcept;
+		unrolled_list                  (const this_type& other)                        noexcept;
+		template<typename Container = this_type>
+		unrolled_list                  (const Container& other)                        noexcept;
+
+		~unrolled_list                 ()                                              noexcept;
+
+		void push_back                 (const T& item)                                 noexcept;
+		void push_front                (const T& item)                                 noexcept;
+
+		void pop_back                  ();
+		void pop_front                 ();
+		void fill                      (const T& item)                                 noexcept;
+		void clear                     ()                                              noexcept;
+		void emplace                   (iterator pos, const T& item)                   noexcept;
+		void swap                      (this_type& other)                              noexcept;
+
+		iterator find                  (const T& item)                                 noexcept;
+		const_iterator find            (const T& item)const                            noexcept;
+
+		iterator insert                (const iterator& pos, const T& item)            noexcept;
+		iterator insert                (const iterator& pos, size_t count,
+                                        const T& item)                                 noexcept;
+		template<typename InputIterator>
+		iterator insert                (const iterator& pos,
+                                        InputIterator first,
+                                        InputIterator last)                            noexcept;
+
+		iterator erase                 (const iterator& pos);
+		iterator erase                 (iterator first, const iterator& last);
+
+		iterator erase_all             (const T& item)                                 noexcept;
+		iterator erase_first           (const T& item)                                 noexcept;
+
+		iterator begin                 ()                                              noexcept;
+		const_iterator begin           ()const                                         noexcept;
+		const_iterator cbegin          ()const                                         noexcept;
+		reverse_iterator rbegin        ()                                              noexcept;
+		const_reverse_iterator rbegin  ()const                                         noexcept;
+		const_reverse_iterator crbegin ()const                                         noexcept;
+
+		iterator end                   ()                                              noexcept;
+		const_iterator end             ()const                                         noexcept;
+		const_iterator cend            ()const                                         noexcept;
+		reverse_iterator rend          ()                                              noexcept;
+		const_reverse_iterator rend    ()const                                         noexcept;
+		const_reverse_iterator crend   ()const                                         noexcept;
+
+		size_t size                    ()const                                         noexcept;
+		size_t max_size                ()const                                         noexcept;
+		size_t chunk_size              ()const                                         noexcept;
+		size_t chunk_count             ()const                                         noexcept;
+
+		bool empty                     ()const                                         noexcept;
+
+		reference front                ();
+		reference back                 ();
+		const_reference front          ()const;
+		const_reference back           ()const;
+
+		this_type& operator=           (const this_type& other)                        noexcept;
+		template<typename Container = this_type>
+		this_type& operator=           (const Container& other)                        noexcept;
+	protected:
+		Link   sentinel;
+		size_t SIZE;
+		size_t CHUNKS;
+	private:
+		Node* create_after             (pointer_type link)                             noexcept;
+		void destroy                   (pointer_type link)                             noexcept;
+		void adopt                     (this_type& other)                              noexcept;
+
+		static Node* node              (pointer_type link)                             noexcept;
+	};
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::unrolled_list() noexcept {
+		SIZE = CHUNKS = 0;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::unrolled_list(const std::initializer_list<T>& items) noexcept : unrolled_list() {
+		for (const auto& item : items) {
+			push_back(item);
+		}
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::unrolled_list(size_t count, const T& item) noexcept : unrolled_list() {
+		while (count-- > 0) {
+			push_back(item);
+		}
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::unrolled_list(const T& item) noexcept : unrolled_list() {
+		push_back(item);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::unrolled_list(const this_type& other) noexcept : unrolled_list() {
+		*this = other;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	template<typename Container>
+	inline unrolled_list<T, ChunkSize>::unrolled_list(const Container& other) noexcept : unrolled_list() {
+		*this = other;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline unrolled_list<T, ChunkSize>::~unrolled_list() noexcept {
+		clear();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::push_back(const T& item) noexcept {
+		pointer_type last = sentinel.prev;
+		if (last == &sentinel || last->count == ChunkSize) {
+			last = create_after(last);
+		}
+		new (node(last)->items() + last->count) T(item);
+		++last->count;
+		++SIZE;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::push_front(const T& item) noexcept {
+		insert(begin(), item);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::pop_back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		pointer_type last = sentinel.prev;
+		node(last)->items()[--last->count].~T();
+		if (last->count == 0) {
+			destroy(last);
+		}
+		--SIZE;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::pop_front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		erase(begin());
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::fill(const T& item) noexcept {
+		for (auto& elem : *this) {
+			elem = item;
+		}
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::clear() noexcept {
+		while (sentinel.next != &sentinel) {
+			destroy(sentinel.next);
+		}
+		SIZE = 0;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::emplace(iterator pos, const T& item) noexcept {
+		*pos = item;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::swap(this_type& other) noexcept {
+		yo::swap(sentinel, other.sentinel);
+		yo::swap(SIZE, other.SIZE);
+		yo::swap(CHUNKS, other.CHUNKS);
+		adopt(other);
+		other.adopt(*this);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::find(const T& item) noexcept {
+		for (pointer_type link = sentinel.next; link != &sentinel; link = link->next) {
+			const Node* chunk = node(link);
+			for (size_t i = 0; i < link->count; ++i) {
+				if (chunk->items()[i] == item) {
+					return iterator(link, i);
+				}
+			}
+		}
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_iterator unrolled_list<T, ChunkSize>::find(const T& item) const noexcept {
+		iterator result = const_cast<this_type*>(this)->find(item);
+		return const_iterator(result.ptr, result.index);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::insert(const iterator& pos, const T& item) noexcept {
+		T value(item);
+		pointer_type link = pos.ptr;
+		size_t index = pos.index;
+
+		if (link == &sentinel || (index == 0 && link->prev != &sentinel && link->prev->count < ChunkSize)) {
+			link = link->prev;
+			if (link == &sentinel || link->count == ChunkSize) {
+				link = create_after(link);
+			}
+			index = link->count;
+		}
+		else if (link->count == ChunkSize) {
+			Node* full = node(link);
+			Node* half = create_after(link);
+			size_t keep = ChunkSize / 2;
+
+			for (size_t i = keep; i < ChunkSize; ++i) {
+				new (half->items() + (i - keep)) T(std::move(full->items()[i]));
+				full->items()[i].~T();
+			}
+			half->count = ChunkSize - keep;
+			full->count = keep;
+
+			if (index > keep) {
+				link = half;
+				index -= keep;
+			}
+		}
+
+		T* items = node(link)->items();
+		if (index == link->count) {
+			new (items + index) T(std::move(value));
+		}
+		else {
+			new (items + link->count) T(std::move(items[link->count - 1]));
+			for (size_t i = link->count - 1; i > index; --i) {
+				items[i] = std::move(items[i - 1]);
+			}
+			items[index] = std::move(value);
+		}
+		++link->count;
+		++SIZE;
+
+		return iterator(link, index);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::insert(const iterator& pos, size_t count, const T& item) noexcept {
+		T value(item);
+		iterator result = pos;
+		while (count-- > 0) {
+			result = insert(result, value);
+		}
+		return result;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	template<typename InputIterator>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::insert(const iterator& pos, InputIterator first, InputIterator last) noexcept {
+		if (first == last) {
+			return pos;
+		}
+
+		iterator result = insert(pos, *first++);
+		iterator it = result;
+		while (first != last) {
+			it = insert(++it, *first++);
+		}
+		return result;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::erase(const iterator& pos) {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		pointer_type link = pos.ptr;
+		size_t index = pos.index;
+		T* items = node(link)->items();
+
+		for (size_t i = index + 1; i < link->count; ++i) {
+			items[i - 1] = std::move(items[i]);
+		}
+		items[--link->count].~T();
+		--SIZE;
+
+		if (link->count == 0) {
+			pointer_type next = link->next;
+			destroy(link);
+			return iterator(next, 0);
+		}
+
+		pointer_type next = link->next;
+		if (next != &sentinel && link->count < ChunkSize / 2 && link->count + next->count <= ChunkSize) {
+			T* other = node(next)->items();
+			for (size_t i = 0; i < next->count; ++i) {
+				new (items + (link->count + i)) T(std::move(other[i]));
+			}
+			link->count += next->count;
+			destroy(next);
+		}
+
+		if (index < link->count) {
+			return iterator(link, index);
+		}
+		return iterator(link->next, 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::erase(iterator first, const iterator& last) {
+		size_t count = 0;
+		for (iterator it = first; it != last; ++it) {
+			++count;
+		}
+
+		while (count-- > 0) {
+			first = erase(first);
+		}
+		return first;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::erase_all(const T& item) noexcept {
+		T value(item);
+		iterator write = begin();
+		size_t kept = 0;
+
+		for (iterator read = begin(); read != end(); ++read) {
+			if (!(*read == value)) {
+				if (write != read) {
+					*write = std::move(*read);
+				}
+				++write;
+				++kept;
+			}
+		}
+
+		while (SIZE > kept) {
+			pop_back();
+		}
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::erase_first(const T& item) noexcept {
+		iterator i = find(item);
+		if (i != end()) {
+			return erase(i);
+		}
+		return i;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::begin() noexcept {
+		return iterator(sentinel.next, 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_iterator unrolled_list<T, ChunkSize>::begin() const noexcept {
+		return const_iterator(sentinel.next, 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_iterator unrolled_list<T, ChunkSize>::cbegin() const noexcept {
+		return const_iterator(sentinel.next, 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::reverse_iterator unrolled_list<T, ChunkSize>::rbegin() noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reverse_iterator unrolled_list<T, ChunkSize>::rbegin() const noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reverse_iterator unrolled_list<T, ChunkSize>::crbegin() const noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::iterator unrolled_list<T, ChunkSize>::end() noexcept {
+		return iterator(&sentinel, 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_iterator unrolled_list<T, ChunkSize>::end() const noexcept {
+		return const_iterator(const_cast<pointer_type>(&sentinel), 0);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_iterator unrolled_list<T, ChunkSize>::cend() const noexcept {
+		return end();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::reverse_iterator unrolled_list<T, ChunkSize>::rend() noexcept {
+		return begin();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reverse_iterator unrolled_list<T, ChunkSize>::rend() const noexcept {
+		return begin();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reverse_iterator unrolled_list<T, ChunkSize>::crend() const noexcept {
+		return begin();
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline size_t unrolled_list<T, ChunkSize>::size() const noexcept {
+		return SIZE;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline size_t unrolled_list<T, ChunkSize>::max_size() const noexcept {
+		return (size_t)-1;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline size_t unrolled_list<T, ChunkSize>::chunk_size() const noexcept {
+		return ChunkSize;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline size_t unrolled_list<T, ChunkSize>::chunk_count() const noexcept {
+		return CHUNKS;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline bool unrolled_list<T, ChunkSize>::empty() const noexcept {
+		return SIZE == 0;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::reference unrolled_list<T, ChunkSize>::front() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		return node(sentinel.next)->items()[0];
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::reference unrolled_list<T, ChunkSize>::back() {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		return node(sentinel.prev)->items()[sentinel.prev->count - 1];
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reference unrolled_list<T, ChunkSize>::front() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		return node(sentinel.next)->items()[0];
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::const_reference unrolled_list<T, ChunkSize>::back() const {
+		YO_ASSERT_THROW(SIZE == 0, "Empty list");
+		return node(sentinel.prev)->items()[sentinel.prev->count - 1];
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::this_type& unrolled_list<T, ChunkSize>::operator=(const this_type& other) noexcept {
+		if (this != &other) {
+			clear();
+			for (const auto& item : other) {
+				push_back(item);
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	template<typename Container>
+	inline typename unrolled_list<T, ChunkSize>::this_type& unrolled_list<T, ChunkSize>::operator=(const Container& other) noexcept {
+		clear();
+		for (const auto& item : other) {
+			push_back(item);
+		}
+		return *this;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::Node* unrolled_list<T, ChunkSize>::create_after(pointer_type link) noexcept {
+		Node* result = new Node;
+		result->prev = link;
+		result->next = link->next;
+		link->next->prev = result;
+		link->next = result;
+		++CHUNKS;
+		return result;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::destroy(pointer_type link) noexcept {
+		link->prev->next = link->next;
+		link->next->prev = link->prev;
+		T* items = node(link)->items();
+		for (size_t i = 0; i < link->count; ++i) {
+			items[i].~T();
+		}
+		delete node(link);
+		--CHUNKS;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline void unrolled_list<T, ChunkSize>::adopt(this_type& other) noexcept {
+		if (sentinel.next == &other.sentinel) {
+			sentinel.next = sentinel.prev = &sentinel;
+		}
+		else {
+			sentinel.next->prev = &sentinel;
+			sentinel.prev->next = &sentinel;
+		}
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline typename unrolled_list<T, ChunkSize>::Node* unrolled_list<T, ChunkSize>::node(pointer_type link) noexcept {
+		return static_cast<Node*>(link);
+	}
+
+
+
+	template<typename T, size_t ChunkSize>
+	inline bool operator==(const unrolled_list<T, ChunkSize>& left, const unrolled_list<T, ChunkSize>& right) {
+		return left.size() == right.size() && yo::equal(left.begin(), left.end(), right.begin());
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline bool operator!=(const unrolled_list<T, ChunkSize>& left, const unrolled_list<T, ChunkSize>& right) {
+		return !(left == right);
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline bool operator>(const unrolled_list<T, ChunkSize>& left, const unrolled_list<T, ChunkSize>& right) {
+		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 1;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	inline bool operator<(const unrolled_list<T, ChunkSize>& left, const unrolled_list<T, ChunkSize>& right) {
+		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == -1;
+	}
+
+
+	template<typename T, size_t ChunkSize>
+	void swap(unrolled_list<T, ChunkSize>& left, unrolled_list<T, ChunkSize>& right) {
+		left.swap(right);
+	}
+
+
+}
\ No newline at end of file
@@ -1,22 +1,105 @@
 #pragma once
 
 
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
 #include <random>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
 
 
 namespace yo {
 
 
+	constexpr bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+		return std::is_constant_evaluated();
+#elif defined(__GNUC__) && __GNUC__ >= 9
+		return __builtin_is_constant_evaluated();
+#elif defined(__clang__) && __clang_major__ >= 9
+		return __builtin_is_constant_evaluated();
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+		return __builtin_is_constant_evaluated();
+#else
+		return false;
+#endif
+	}
+
+
+	template<size_t N, typename T>
+	inline T* assume_aligned(T* ptr) noexcept {
+#if defined(__cpp_lib_assume_aligned)
+		return std::assume_aligned<N>(ptr);
+#elif defined(__GNUC__) || defined(__clang__)
+		return static_cast<T*>(__builtin_assume_aligned(ptr, N));
+#else
+		return ptr;
+#endif
+	}
+
+
 	template<typename T>
-	void swap(T& a, T& b) {
-		T temp = a;
-		a = b;
-		b = temp;
+	constexpr void swap(T& a, T& b) {
+		T temp(std::move(a));
+		a = std::move(b);
+		b = std::move(temp);
+	}
+
+
+	template<typename Iterator, typename Tag, typename = void>
+	struct has_iterator_category : std::false_type {};
+
+
+	template<typename Iterator, typename Tag>
+	struct has_iterator_category<Iterator, Tag, std::void_t<typename std::iterator_traits<Iterator>::iterator_category>>
+		: std::is_base_of<Tag, typename std::iterator_traits<Iterator>::iterator_category> {};
+
+
+	template<typename Iterator>
+	struct is_forward_iterator : has_iterator_category<Iterator, std::forward_iterator_tag> {};
+
+
+	template<typename Iterator>
+	struct is_random_access : has_iterator_category<Iterator, std::random_access_iterator_tag> {};
+
+
+	template<typename Iterator>
+	constexpr size_t distance(Iterator first, Iterator last, std::false_type) {
+		size_t count = 0;
+		for (; first != last; ++first) {
+			++count;
+		}
+		return count;
+	}
+
+
+	template<typename Iterator>
+	constexpr size_t distance(Iterator first, Iterator last, std::true_type) {
+		return (size_t)(last - first);
+	}
+
+
+	template<typename Iterator>
+	constexpr size_t distance(Iterator first, Iterator last) {
+		return yo::distance(first, last, is_random_access<Iterator>());
 	}
 
 
 	template<typename Iterator>
-	short compare(Iterator lbegin, Iterator rbegin, const Iterator& lend, const Iterator& rend) {
+	struct is_trivially_comparable {
+		typedef typename std::remove_cv<typename std::remove_pointer<Iterator>::type>::type value;
+
+		static const bool result = std::is_pointer<Iterator>::value &&
+			(std::is_integral<value>::value || std::is_enum<value>::value || std::is_pointer<value>::value);
+	};
+
+
+	template<typename Iterator>
+	constexpr short compare_elements(Iterator lbegin, Iterator rbegin, const Iterator& lend, const Iterator& rend) {
 		while (lbegin != lend && rbegin != rend) {
 			if (*lbegin > *rbegin) {
 				return 1;
@@ -29,8 +112,68 @@ namespace yo {
 	}
 
 
+	template<typename Iterator>
+	constexpr short compare(Iterator lbegin, Iterator rbegin, const Iterator& lend, const Iterator& rend, std::false_type) {
+		return compare_elements(lbegin, rbegin, lend, rend);
+	}
+
+
+	template<typename Iterator>
+	constexpr short compare(Iterator lbegin, Iterator rbegin, const Iterator& lend, const Iterator& rend, std::true_type) {
+		if (is_constant_evaluated()) {
+			return compare_elements(lbegin, rbegin, lend, rend);
+		}
+
+		const size_t block = 64 / sizeof(*lbegin) == 0 ? 1 : 64 / sizeof(*lbegin);
+		size_t length = lend - lbegin < rend - rbegin ? lend - lbegin : rend - rbegin;
+
+		while (length > 0) {
+			size_t count = length < block ? length : block;
+			if (std::memcmp(lbegin, rbegin, count * sizeof(*lbegin)) != 0) {
+				return compare_elements(lbegin, rbegin, lbegin + count, rbegin + count);
+			}
+			lbegin += count;
+			rbegin += count;
+			length -= count;
+		}
+		return 0;
+	}
+
+
+	template<typename Iterator>
+	constexpr short compare(Iterator lbegin, Iterator rbegin, const Iterator& lend, const Iterator& rend) {
+		return compare(lbegin, rbegin, lend, rend, std::integral_constant<bool, is_trivially_comparable<Iterator>::result>());
+	}
+
+
+	template<typename Iterator>
+	constexpr bool equal(Iterator lbegin, const Iterator& lend, Iterator rbegin, std::false_type) {
+		while (lbegin != lend) {
+			if (!(*lbegin++ == *rbegin++)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	template<typename Iterator>
+	constexpr bool equal(Iterator lbegin, const Iterator& lend, Iterator rbegin, std::true_type) {
+		if (is_constant_evaluated()) {
+			return equal(lbegin, lend, rbegin, std::false_type());
+		}
+		return lbegin == lend || std::memcmp(lbegin, rbegin, (lend - lbegin) * sizeof(*lbegin)) == 0;
+	}
+
+
+	template<typename Iterator>
+	constexpr bool equal(Iterator lbegin, const Iterator& lend, Iterator rbegin) {
+		return equal(lbegin, lend, rbegin, std::integral_constant<bool, is_trivially_comparable<Iterator>::result>());
+	}
+
+
 	template<typename Iterator, typename T>
-	Iterator find_first(Iterator first, Iterator last, const T& value) {
+	constexpr Iterator find_first(Iterator first, Iterator last, const T& value, std::false_type) {
 		while (first != last) {
 			if (*first == value) {
 				return first;
@@ -41,12 +184,406 @@ namespace yo {
 	}
 
 
+	template<typename Iterator, typename T>
+	constexpr Iterator find_first(Iterator first, Iterator last, const T& value, std::true_type) {
+		if (is_constant_evaluated()) {
+			return find_first(first, last, value, std::false_type());
+		}
+		return first + (simd_find<T>(first, last, value) - first);
+	}
+
+
+	template<typename Iterator, typename T>
+	constexpr Iterator find_first(Iterator first, Iterator last, const T& value) {
+		return find_first(first, last, value, std::integral_constant<bool,
+			std::is_pointer<Iterator>::value && is_simd_type<T>::value &&
+			std::is_same<typename std::remove_cv<typename std::remove_pointer<Iterator>::type>::type, T>::value>());
+	}
+
+
+	template<typename Iterator, typename Predicate>
+	constexpr Iterator find_if(Iterator first, Iterator last, Predicate pred) {
+		while (first != last) {
+			if (pred(*first)) {
+				return first;
+			}
+			++first;
+		}
+		return last;
+	}
+
+
+	template<typename Iterator, typename T, typename Compare>
+	constexpr Iterator lower_bound(Iterator first, Iterator last, const T& value, Compare comp) {
+		size_t count = last - first;
+		while (count > 0) {
+			size_t half = count / 2;
+			if (comp(first[half], value)) {
+				first += half + 1;
+				count -= half + 1;
+			}
+			else {
+				count = half;
+			}
+		}
+		return first;
+	}
+
+
+	template<typename Iterator, typename T>
+	constexpr Iterator lower_bound(Iterator first, Iterator last, const T& value) {
+		return yo::lower_bound(first, last, value, [](const T& left, const T& right) { return left < right; });
+	}
+
+
+	template<typename Iterator, typename T>
+	constexpr bool binary_search(Iterator first, Iterator last, const T& value) {
+		Iterator found = yo::lower_bound(first, last, value);
+		return found != last && !(value < *found);
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void insertion_sort(Iterator first, Iterator last, Compare comp) {
+		for (Iterator i = first; i != last; ++i) {
+			for (Iterator j = i; j != first && comp(*j, *(j - 1)); --j) {
+				yo::swap(*j, *(j - 1));
+			}
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void heap_sort(Iterator first, Iterator last, Compare comp) {
+		size_t size = last - first;
+		for (size_t start = size / 2; start-- > 0;) {
+			for (size_t pos = start, child = 0; (child = pos * 2 + 1) < size; pos = child) {
+				if (child + 1 < size && comp(first[child], first[child + 1])) {
+					++child;
+				}
+				if (!comp(first[pos], first[child])) {
+					break;
+				}
+				yo::swap(first[pos], first[child]);
+			}
+		}
+		while (size > 1) {
+			yo::swap(first[0], first[--size]);
+			for (size_t pos = 0, child = 0; (child = pos * 2 + 1) < size; pos = child) {
+				if (child + 1 < size && comp(first[child], first[child + 1])) {
+					++child;
+				}
+				if (!comp(first[pos], first[child])) {
+					break;
+				}
+				yo::swap(first[pos], first[child]);
+			}
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void sort3(Iterator a, Iterator b, Iterator c, Compare comp) {
+		if (comp(*b, *a)) {
+			yo::swap(*a, *b);
+		}
+		if (comp(*c, *b)) {
+			yo::swap(*b, *c);
+		}
+		if (comp(*b, *a)) {
+			yo::swap(*a, *b);
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr bool partial_insertion_sort(Iterator first, Iterator last, Compare comp) {
+		size_t moves = 0;
+		for (Iterator i = first; i != last; ++i) {
+			Iterator j = i;
+			for (; j != first && comp(*j, *(j - 1)); --j) {
+				yo::swap(*j, *(j - 1));
+			}
+			moves += i - j;
+			if (moves > 8) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr Iterator partition_left(Iterator first, Iterator last, Compare comp) {
+		typename std::decay<decltype(*first)>::type pivot(std::move(*first));
+		Iterator left = first;
+		Iterator right = last;
+
+		while (comp(pivot, *--right));
+		if (right + 1 == last) {
+			while (left < right && !comp(pivot, *++left));
+		}
+		else {
+			while (!comp(pivot, *++left));
+		}
+
+		while (left < right) {
+			yo::swap(*left, *right);
+			while (comp(pivot, *--right));
+			while (!comp(pivot, *++left));
+		}
+
+		*first = std::move(*right);
+		*right = std::move(pivot);
+		return right;
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr Iterator partition_right(Iterator first, Iterator last, Compare comp, bool& partitioned) {
+		typename std::decay<decltype(*first)>::type pivot(std::move(*first));
+		Iterator left = first;
+		Iterator right = last;
+
+		while (comp(*++left, pivot));
+		if (left - 1 == first) {
+			while (left < right && !comp(*--right, pivot));
+		}
+		else {
+			while (!comp(*--right, pivot));
+		}
+
+		partitioned = left >= right;
+		while (left < right) {
+			yo::swap(*left, *right);
+			while (comp(*++left, pivot));
+			while (!comp(*--right, pivot));
+		}
+
+		Iterator pos = left - 1;
+		*first = std::move(*pos);
+		*pos = std::move(pivot);
+		return pos;
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void pdq_sort(Iterator first, Iterator last, Compare comp, size_t bad_allowed, bool leftmost) {
+		while (true) {
+			size_t size = last - first;
+			if (size < 24) {
+				yo::insertion_sort(first, last, comp);
+				return;
+			}
+
+			size_t half = size / 2;
+			if (size > 128) {
+				yo::sort3(first, first + half, last - 1, comp);
+				yo::sort3(first + 1, first + (half - 1), last - 2, comp);
+				yo::sort3(first + 2, first + (half + 1), last - 3, comp);
+				yo::sort3(first + (half - 1), first + half, first + (half + 1), comp);
+				yo::swap(*first, *(first + half));
+			}
+			else {
+				yo::sort3(first + half, first, last - 1, comp);
+			}
+
+			if (!leftmost && !comp(*(first - 1), *first)) {
+				first = yo::partition_left(first, last, comp) + 1;
+				continue;
+			}
+
+			bool partitioned = false;
+			Iterator pos = yo::partition_right(first, last, comp, partitioned);
+			size_t lsize = pos - first;
+			size_t rsize = last - (pos + 1);
+
+			if (lsize < size / 8 || rsize < size / 8) {
+				if (--bad_allowed == 0) {
+					yo::heap_sort(first, last, comp);
+					return;
+				}
+				if (lsize >= 24) {
+					yo::swap(*first, *(first + lsize / 4));
+					yo::swap(*(pos - 1), *(pos - lsize / 4));
+				}
+				if (rsize >= 24) {
+					yo::swap(*(pos + 1), *(pos + (1 + rsize / 4)));
+					yo::swap(*(last - 1), *(last - rsize / 4));
+				}
+			}
+			else if (partitioned && yo::partial_insertion_sort(first, pos, comp) && yo::partial_insertion_sort(pos + 1, last, comp)) {
+				return;
+			}
+
+			yo::pdq_sort(first, pos, comp, bad_allowed, leftmost);
+			first = pos + 1;
+			leftmost = false;
+		}
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void pdq_sort(Iterator first, Iterator last, Compare comp) {
+		size_t bad_allowed = 1;
+		for (size_t size = last - first; size > 1; size >>= 1) {
+			++bad_allowed;
+		}
+		yo::pdq_sort(first, last, comp, bad_allowed, true);
+	}
+
+
+	template<typename Iterator, typename Compare>
+	constexpr void sort(Iterator first, Iterator last, Compare comp) {
+		yo::pdq_sort(first, last, comp);
+	}
+
+
+	template<typename Iterator>
+	constexpr void sort(Iterator first, Iterator last) {
+		yo::sort(first, last, [](const auto& left, const auto& right) { return left < right; });
+	}
+
+
+	class random_engine {
+	public:
+		typedef uint64_t result_type;
+	public:
+		random_engine                 ()                     noexcept;
+		explicit random_engine        (uint64_t seed)        noexcept;
+
+		void seed                     (uint64_t seed)        noexcept;
+
+		uint64_t bounded              (uint64_t range)       noexcept;
+
+		result_type operator()        ()                     noexcept;
+
+		static constexpr result_type min ()                  noexcept { return 0; }
+		static constexpr result_type max ()                  noexcept { return (result_type)-1; }
+	private:
+		static uint64_t rotl          (uint64_t x, int k)    noexcept;
+	private:
+		uint64_t state[4];
+	};
+
+
+	inline random_engine::random_engine() noexcept {
+		std::random_device rd;
+		seed(((uint64_t)rd() << 32) ^ rd());
+	}
+
+
+	inline random_engine::random_engine(uint64_t seed) noexcept {
+		this->seed(seed);
+	}
+
+
+	inline void random_engine::seed(uint64_t seed) noexcept {
+		for (auto& word : state) {
+			uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			word = z ^ (z >> 31);
+		}
+	}
+
+
+	inline uint64_t random_engine::bounded(uint64_t range) noexcept {
+#if defined(__SIZEOF_INT128__)
+		__uint128_t product = (__uint128_t)operator()() * range;
+		uint64_t low = (uint64_t)product;
+		if (low < range) {
+			uint64_t threshold = (0 - range) % range;
+			while (low < threshold) {
+				product = (__uint128_t)operator()() * range;
+				low = (uint64_t)product;
+			}
+		}
+		return (uint64_t)(product >> 64);
+#else
+		uint64_t threshold = (0 - range) % range;
+		uint64_t value = operator()();
+		while (value < threshold) {
+			value = operator()();
+		}
+		return value % range;
+#endif
+	}
+
+
+	inline random_engine::result_type random_engine::operator()() noexcept {
+		uint64_t result = rotl(state[1] * 5, 7) * 9;
+		uint64_t t = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+
+		return result;
+	}
+
+
+	inline uint64_t random_engine::rotl(uint64_t x, int k) noexcept {
+		return (x << k) | (x >> (64 - k));
+	}
+
+
+	inline random_engine& thread_random_engine() noexcept {
+		static thread_local random_engine engine;
+		return engine;
+	}
+
+
+	inline void seed_random(uint64_t seed) noexcept {
+		thread_random_engine().seed(seed);
+	}
+
+
 	template<typename Int>
 	Int random(Int left, Int right) {
-		std::random_device rd;
-		std::mt19937 gen(rd());
-		std::uniform_int_distribution<Int> dis(left, right);
-		return dis(gen);
+		typedef typename std::make_unsigned<Int>::type Unsigned;
+
+		random_engine& engine = thread_random_engine();
+		uint64_t span = (uint64_t)(Unsigned)((Unsigned)right - (Unsigned)left);
+
+		if (span == (uint64_t)-1) {
+			return (Int)engine();
+		}
+		return (Int)((Unsigned)left + (Unsigned)engine.bounded(span + 1));
+	}
+
+
+	template<typename Iterator>
+	void shuffle(Iterator first, Iterator last) {
+		random_engine& engine = thread_random_engine();
+		size_t count = last - first;
+
+		while (count > 1) {
+			size_t index = (size_t)engine.bounded(count--);
+			yo::swap(first[count], first[index]);
+		}
+	}
+
+
+	template<typename InputIterator, typename OutputIterator>
+	size_t sample(InputIterator first, InputIterator last, OutputIterator out, size_t count) {
+		random_engine& engine = thread_random_engine();
+		size_t seen = 0;
+
+		for (; first != last && seen < count; ++first) {
+			out[seen++] = *first;
+		}
+		for (; first != last; ++first) {
+			size_t index = (size_t)engine.bounded(++seen);
+			if (index < count) {
+				out[index] = *first;
+			}
+		}
+
+		return seen < count ? seen : count;
 	}
 
 
@@ -7,6 +7,8 @@
 
 
 #include <initializer_list>
+#include <new>
+#include <numeric>
 
 #include "utility.h"
 #include "iterators/reverse_iterator.h"
@@ -15,8 +17,9 @@
 namespace yo {
 
 
-	template<typename T, size_t _capacity = 2>
+	template<typename T, size_t _capacity = 2, size_t _alignment = alignof(T)>
 	class vector {
+		static_assert((_alignment & (_alignment - 1)) == 0 && _alignment >= alignof(T), "Alignment must be a power of two not less than alignof(T)");
 	public:
 		typedef T                                                             value;
 		typedef T&                                                            reference;
@@ -25,13 +28,18 @@ namespace yo {
 		typedef const T*                                                      const_iterator;
 		typedef reverse_iterator<T, const T*, const T&, const_iterator>       const_reverse_iterator;
 		typedef reverse_iterator<T, T*, T&, iterator>                         reverse_iterator;
+		typedef vector<T, _capacity, _alignment>                              this_type;
+	public:
+		static const size_t ALIGNMENT = _alignment;
+		static const size_t LANES     = _alignment / std::gcd(_alignment, sizeof(T));
 	public:
 		vector                         ();
 		vector                         (const std::initializer_list<T>& list) noexcept;
 		vector                         (size_t count, const T& item)          noexcept;
-		vector                         (const vector<T>& other)               noexcept;
+		vector                         (const this_type& other)               noexcept;
+		vector                         (this_type&& other)                    noexcept;
 		vector                         (const T& item)                        noexcept;
-		template<typename Container = vector<T>>
+		template<typename Container = this_type>
 		vector                         (const Container & other)              noexcept;
 
 		~vector                        ()                                     noexcept;
@@ -45,8 +53,9 @@ namespace yo {
 		void resize                    (size_t newsize)                       noexcept;
 		void reserve                   (size_t newcap)                        noexcept;
 		void reverse                   ()                                     noexcept;
+		void shuffle                   ()                                     noexcept;
 		void emplace                   (const iterator& it, const T& item)    noexcept;
-		void swap                      (vector<T>& other)                     noexcept;
+		void swap                      (this_type& other)                     noexcept;
 		void shrink_to_fit             ()                                     noexcept;
 
 		iterator insert                (const_iterator pos, const T& item)    noexcept;
@@ -97,9 +106,12 @@ namespace yo {
 
 		reference random               ();
 		const_reference random         ()const;
+		vector<T> sample               (size_t count)const                    noexcept;
 
 		T* data                        ()                                     noexcept;
 		const T* data                  ()const                                noexcept;
+		T* data_aligned                ()                                     noexcept;
+		const T* data_aligned          ()const                                noexcept;
 
 		reference at                   (const size_t& pos);
 		const_reference at             (const size_t& pos)const;
@@ -107,9 +119,10 @@ namespace yo {
 		reference operator[]           (const size_t& pos);
 		const_reference operator[]     (const size_t& pos)const;
 
-		vector<T>& operator=           (const vector<T>& other)               noexcept;
-		template<typename Container = vector<T>>
-		vector<T>& operator=           (const Container& other)               noexcept;
+		this_type& operator=           (const this_type& other)               noexcept;
+		this_type& operator=           (this_type&& other)                    noexcept;
+		template<typename Container = this_type>
+		this_type& operator=           (const Container& other)               noexcept;
 	protected:
 		size_t SIZE;
 		size_t CAP;
@@ -118,19 +131,25 @@ namespace yo {
 	private:
 		void replace_elems             (size_t _oldsize, size_t _newsize)     noexcept;
 		void calculate_new_cap         ()                                     noexcept;
+
+		static size_t padded           (size_t count)                         noexcept;
+		static T* allocate             (size_t count);
+		static void deallocate         (T* elems)                             noexcept;
+	private:
+		static const size_t HEADER = _alignment > sizeof(size_t) ? _alignment : sizeof(size_t);
 	};
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::vector() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector() {
 		YO_ASSERT_THROW(_capacity < 1, "Capacity can not be less than 1!");
 		SIZE = 0;
-		elems = new T[CAP = _capacity];
+		elems = allocate(CAP = padded(_capacity));
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::vector(const std::initializer_list<T>& list) noexcept : vector() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector(const std::initializer_list<T>& list) noexcept : vector() {
 		reserve(list.size());
 		for (const T& item : list) {
 			elems[SIZE++] = item;
@@ -138,122 +157,130 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::vector(size_t count, const T& item) noexcept : vector() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector(size_t count, const T& item) noexcept : vector() {
 		resize(count);
-		while (count > 0) {
-			elems[--count] = item;
-		}
+		simd_fill(elems, elems + count, item);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::vector(const vector<T>& other) noexcept : vector() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector(const this_type& other) noexcept : vector() {
 		*this = other;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::vector(const T& item) noexcept : vector() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector(this_type&& other) noexcept : vector() {
+		swap(other);
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::vector(const T& item) noexcept : vector() {
 		push_back(item);
 	}
 
 
-	template<typename T, size_t _capacity>
+	template<typename T, size_t _capacity, size_t _alignment>
 	template<typename Container>
-	inline vector<T, _capacity>::vector(const Container& other) noexcept : vector() {
+	inline vector<T, _capacity, _alignment>::vector(const Container& other) noexcept : vector() {
 		*this = other;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T, _capacity>::~vector() noexcept {
-		delete[] elems;
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T, _capacity, _alignment>::~vector() noexcept {
+		deallocate(elems);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::push_back(const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::push_back(const T& item) noexcept {
 		calculate_new_cap();
 		elems[SIZE++] = item;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::push_back() noexcept	{
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::push_back() noexcept	{
 		calculate_new_cap();
 		return elems[SIZE++];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::push_back_uinitialized() noexcept	{
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::push_back_uinitialized() noexcept	{
 		calculate_new_cap();
 		++SIZE;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::pop_back() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::pop_back() {
 		YO_ASSERT_THROW(SIZE-- == 0, "Empty vector");
 		calculate_new_cap();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::clear() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::clear() noexcept {
 		replace_elems(SIZE = 0, CAP = _capacity);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::resize(size_t newsize) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::resize(size_t newsize) noexcept {
 		CAP = newsize < _capacity ? _capacity : newsize;
 		replace_elems(SIZE < newsize ? SIZE : newsize, CAP);
 		SIZE = newsize;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::reserve(size_t newcap) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::reserve(size_t newcap) noexcept {
 		if (newcap > CAP) {
 			replace_elems(SIZE, CAP = newcap);
 		}
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::reverse() noexcept {
-		for (size_t i = 0, j = empty() ? SIZE : SIZE - 1; i < j; ++i, --j) {
-			swap(elems[i], elems[j]);
-		}
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::reverse() noexcept {
+		simd_reverse(elems, elems + SIZE);
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::shuffle() noexcept {
+		yo::shuffle(begin(), end());
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::emplace(const iterator& it, const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::emplace(const iterator& it, const T& item) noexcept {
 		*it = item;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::swap(vector<T>& other) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::swap(this_type& other) noexcept {
 		yo::swap(CAP, other.CAP);
 		yo::swap(SIZE, other.SIZE);
 		yo::swap(elems, other.elems);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::shrink_to_fit() noexcept {
-		if (CAP != SIZE) {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::shrink_to_fit() noexcept {
+		if (CAP != padded(SIZE < _capacity ? _capacity : SIZE)) {
 			replace_elems(SIZE, CAP = SIZE < _capacity ? _capacity : SIZE);
 		}
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::insert(const_iterator pos, const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::insert(const_iterator pos, const T& item) noexcept {
 		if (empty()) { push_back(item); return end() - 1; }
 
 		T last = back();
@@ -268,8 +295,8 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::insert(const_iterator pos, size_t count, const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::insert(const_iterator pos, size_t count, const T& item) noexcept {
 		while (count-- > 0) {
 			pos = insert(pos, item);
 		}
@@ -277,18 +304,36 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
+	template<typename T, size_t _capacity, size_t _alignment>
 	template<typename InputIterator>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::insert(const_iterator pos, InputIterator first, InputIterator last) noexcept {
-		while (first != last) {
-			pos = insert(pos, *first++);
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::insert(const_iterator pos, InputIterator first, InputIterator last) noexcept {
+		if constexpr (is_forward_iterator<InputIterator>::value) {
+			size_t diff = pos - elems;
+			size_t count = yo::distance(first, last);
+			if (SIZE + count > CAP) {
+				reserve(SIZE + count > CAP * 2 ? SIZE + count : CAP * 2);
+			}
+
+			for (size_t i = SIZE; i-- > diff;) {
+				elems[i + count] = std::move(elems[i]);
+			}
+			for (size_t i = diff; first != last; ++first, ++i) {
+				elems[i] = *first;
+			}
+			SIZE += count;
+			return elems + diff;
+		}
+		else {
+			while (first != last) {
+				pos = insert(pos, *first++);
+			}
+			return (iterator)pos;
 		}
-		return (iterator)pos;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase(const_iterator pos) {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase(const_iterator pos) {
 		YO_ASSERT_THROW(pos == end(), "Incorrect position");
 
 		size_t diff = pos - elems;
@@ -302,8 +347,8 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase(const_iterator first, const_iterator last) {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase(const_iterator first, const_iterator last) {
 		YO_ASSERT_THROW(first == end(), "Incorrect position");
 
 		while (first != last) {
@@ -316,36 +361,41 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase_all(const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase_all(const T& item) noexcept {
 		return erase_all(begin(), end(), item);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase_all(const_iterator first, const_iterator last, const T& item) noexcept {
-		size_t diff = last - elems;
-		iterator result = (iterator)last;
-		iterator i = erase_first(first, last, item);
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase_all(const_iterator first, const_iterator last, const T& item) noexcept {
+		T value(item);
+		T* hit = nullptr;
+		T* kept = simd_remove((T*)first, (T*)last, value, hit);
+		if (hit == nullptr) {
+			return (iterator)last;
+		}
 
-		while (i != last) {
-			result = i;
-			i = erase_first(i, last = elems + diff - 1, item);
-			diff = last - elems;
+		size_t result = hit - elems;
+		T* tail = (T*)last;
+		while (tail != end()) {
+			*kept++ = *tail++;
 		}
+		SIZE = kept - elems;
+		calculate_new_cap();
 
-		return result;
+		return elems + result;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase_first(const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase_first(const T& item) noexcept {
 		return erase_first(begin(), end(), item);
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::erase_first(const_iterator first, const_iterator last, const T& item) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::erase_first(const_iterator first, const_iterator last, const T& item) noexcept {
 		iterator i = (iterator)yo::find_first(first, last, item);
 
 		if (i != last) {
@@ -356,185 +406,206 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::begin() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::begin() noexcept {
 		return &elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_iterator vector<T, _capacity>::begin()const  noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_iterator vector<T, _capacity, _alignment>::begin()const  noexcept {
 		return &elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_iterator vector<T, _capacity>::cbegin()const  noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_iterator vector<T, _capacity, _alignment>::cbegin()const  noexcept {
 		return &elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reverse_iterator vector<T, _capacity>::rbegin() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reverse_iterator vector<T, _capacity, _alignment>::rbegin() noexcept {
 		return end();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reverse_iterator vector<T, _capacity>::rbegin() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reverse_iterator vector<T, _capacity, _alignment>::rbegin() const noexcept {
 		return cend();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reverse_iterator vector<T, _capacity>::crbegin() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reverse_iterator vector<T, _capacity, _alignment>::crbegin() const noexcept {
 		return cend();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::iterator vector<T, _capacity>::end() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::iterator vector<T, _capacity, _alignment>::end() noexcept {
 		return &elems[SIZE];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_iterator vector<T, _capacity>::end()const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_iterator vector<T, _capacity, _alignment>::end()const noexcept {
 		return &elems[SIZE];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_iterator vector<T, _capacity>::cend()const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_iterator vector<T, _capacity, _alignment>::cend()const noexcept {
 		return &elems[SIZE];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reverse_iterator vector<T, _capacity>::rend() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reverse_iterator vector<T, _capacity, _alignment>::rend() noexcept {
 		return begin();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reverse_iterator vector<T, _capacity>::rend() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reverse_iterator vector<T, _capacity, _alignment>::rend() const noexcept {
 		return cbegin();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reverse_iterator vector<T, _capacity>::crend() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reverse_iterator vector<T, _capacity, _alignment>::crend() const noexcept {
 		return cbegin();
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline bool vector<T, _capacity>::empty() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline bool vector<T, _capacity, _alignment>::empty() const noexcept {
 		return SIZE == 0;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline size_t vector<T, _capacity>::size() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline size_t vector<T, _capacity, _alignment>::size() const noexcept {
 		return SIZE;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline size_t vector<T, _capacity>::max_size() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline size_t vector<T, _capacity, _alignment>::max_size() const noexcept {
 		return (size_t)-1;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline size_t vector<T, _capacity>::capacity() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline size_t vector<T, _capacity, _alignment>::capacity() const noexcept {
 		return CAP;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::front() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::front() {
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[0];
 	}
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::back() {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::back() {
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[SIZE - 1];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reference vector<T, _capacity>::front() const {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reference vector<T, _capacity, _alignment>::front() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reference vector<T, _capacity>::back() const {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reference vector<T, _capacity, _alignment>::back() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[SIZE - 1];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::random()	{
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::random()	{
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[yo::random<size_t>(0, size() - 1)];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reference vector<T, _capacity>::random() const {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reference vector<T, _capacity, _alignment>::random() const {
 		YO_ASSERT_THROW(SIZE == 0, "Empty vector");
 		return elems[yo::random<size_t>(0, size() - 1)];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline T* vector<T, _capacity>::data() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline vector<T> vector<T, _capacity, _alignment>::sample(size_t count) const noexcept {
+		vector<T> result;
+		result.resize(count < SIZE ? count : SIZE);
+		yo::sample(begin(), end(), result.begin(), count);
+		return result;
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline T* vector<T, _capacity, _alignment>::data() noexcept {
 		return &elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline const T* vector<T, _capacity>::data() const noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline const T* vector<T, _capacity, _alignment>::data() const noexcept {
 		return &elems[0];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::at(const size_t& pos) {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline T* vector<T, _capacity, _alignment>::data_aligned() noexcept {
+		return yo::assume_aligned<_alignment>(elems);
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline const T* vector<T, _capacity, _alignment>::data_aligned() const noexcept {
+		return yo::assume_aligned<_alignment>(static_cast<const T*>(elems));
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::at(const size_t& pos) {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reference vector<T, _capacity>::at(const size_t& pos) const {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reference vector<T, _capacity, _alignment>::at(const size_t& pos) const {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::reference vector<T, _capacity>::operator[](const size_t& pos) {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::reference vector<T, _capacity, _alignment>::operator[](const size_t& pos) {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline typename vector<T, _capacity>::const_reference vector<T, _capacity>::operator[](const size_t& pos) const {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::const_reference vector<T, _capacity, _alignment>::operator[](const size_t& pos) const {
 		YO_ASSERT_THROW(pos >= SIZE, "Out of range");
 		return elems[pos];
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline vector<T>& vector<T, _capacity>::operator=(const vector<T>& other) noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::this_type& vector<T, _capacity, _alignment>::operator=(const this_type& other) noexcept {
 		if (this != &other) {
 			SIZE = 0;
 			reserve(other.size());
@@ -546,9 +617,16 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline typename vector<T, _capacity, _alignment>::this_type& vector<T, _capacity, _alignment>::operator=(this_type&& other) noexcept {
+		swap(other);
+		return *this;
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
 	template<typename Container>
-	inline vector<T>& vector<T, _capacity>::operator=(const Container& other) noexcept {
+	inline typename vector<T, _capacity, _alignment>::this_type& vector<T, _capacity, _alignment>::operator=(const Container& other) noexcept {
 		SIZE = 0;
 		reserve(other.size());
 		for (const auto& item : other) {
@@ -558,21 +636,21 @@ namespace yo {
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::replace_elems(size_t _oldsize, size_t _newsize) noexcept {
-		T* _new = new T[_newsize];
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::replace_elems(size_t _oldsize, size_t _newsize) noexcept {
+		T* _new = allocate(CAP = padded(_newsize));
 		for (size_t i = 0; i < _oldsize; ++i) {
 			_new[i] = elems[i];
 		}
-		delete[] elems;
+		deallocate(elems);
 		elems = _new;
 	}
 
 
-	template<typename T, size_t _capacity>
-	inline void vector<T, _capacity>::calculate_new_cap() noexcept {
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::calculate_new_cap() noexcept {
 		size_t new_cap = CAP * 0.5;
-		if (SIZE <= new_cap) {
+		if (SIZE <= new_cap && padded(new_cap < _capacity ? _capacity : new_cap) < CAP) {
 			replace_elems(SIZE, CAP = new_cap < _capacity ? _capacity : new_cap);
 		}
 		else if (SIZE >= CAP) {
@@ -581,36 +659,71 @@ namespace yo {
 	}
 
 
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline size_t vector<T, _capacity, _alignment>::padded(size_t count) noexcept {
+		return (count + LANES - 1) / LANES * LANES;
+	}
 
-	template<typename T>
-	inline bool operator==(const vector<T>& left, const vector<T>& right) {
-		if (yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 0) {
-			return left.size() == right.size();
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline T* vector<T, _capacity, _alignment>::allocate(size_t count) {
+		if (_alignment <= alignof(T)) {
+			return new T[count];
 		}
-		return false;
+
+		char* block = static_cast<char*>(::operator new(HEADER + count * sizeof(T), std::align_val_t(_alignment)));
+		*reinterpret_cast<size_t*>(block) = count;
+		T* elems = reinterpret_cast<T*>(block + HEADER);
+		for (size_t i = 0; i < count; ++i) {
+			new (elems + i) T;
+		}
+		return elems;
+	}
+
+
+	template<typename T, size_t _capacity, size_t _alignment>
+	inline void vector<T, _capacity, _alignment>::deallocate(T* elems) noexcept {
+		if (_alignment <= alignof(T)) {
+			delete[] elems;
+			return;
+		}
+
+		char* block = reinterpret_cast<char*>(elems) - HEADER;
+		size_t count = *reinterpret_cast<size_t*>(block);
+		for (size_t i = 0; i < count; ++i) {
+			elems[i].~T();
+		}
+		::operator delete(block, std::align_val_t(_alignment));
+	}
+
+
+
+	template<typename T, size_t C, size_t A>
+	inline bool operator==(const vector<T, C, A>& left, const vector<T, C, A>& right) {
+		return left.size() == right.size() && yo::equal(left.begin(), left.end(), right.begin());
 	}
 
 
-	template<typename T>
-	inline bool operator!=(const vector<T>& left, const vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	inline bool operator!=(const vector<T, C, A>& left, const vector<T, C, A>& right) {
 		return !(left == right);
 	}
 
 
-	template<typename T>
-	inline bool operator>(const vector<T>& left, const vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	inline bool operator>(const vector<T, C, A>& left, const vector<T, C, A>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == 1;
 	}
 
 
-	template<typename T>
-	inline bool operator<(const vector<T>& left, const vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	inline bool operator<(const vector<T, C, A>& left, const vector<T, C, A>& right) {
 		return yo::compare(left.begin(), right.begin(), left.end(), right.end()) == -1;
 	}
 
 
-	template<typename T>
-	inline bool operator>=(const vector<T>& left, const vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	inline bool operator>=(const vector<T, C, A>& left, const vector<T, C, A>& right) {
 		short result = yo::compare(left.begin(), right.begin(), left.end(), right.end());
 		if (result == 0) {
 			return left.size() == right.size();
@@ -619,8 +732,8 @@ namespace yo {
 	}
 
 
-	template<typename T>
-	inline bool operator<=(const vector<T>& left, const vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	inline bool operator<=(const vector<T, C, A>& left, const vector<T, C, A>& right) {
 		short result = yo::compare(left.begin(), right.begin(), left.end(), right.end());
 		if (result == 0) {
 			return left.size() == right.size();
@@ -629,8 +742,8 @@ namespace yo {
 	}
 
 
-	template<typename T>
-	void swap(vector<T>& left, vector<T>& right) {
+	template<typename T, size_t C, size_t A>
+	void swap(vector<T, C, A>& left, vector<T, C, A>& right) {
 		left.swap(right);
 	}
 
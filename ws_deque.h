@@ -0,0 +1,179 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "vector.h"
+
+
+namespace yo {
+
+
+	template<typename T>
+	struct WsArray {
+		int64_t         CAP;
+		std::atomic<T>* items;
+
+		WsArray(int64_t capacity)
+		:CAP(capacity), items(new std::atomic<T>[capacity]) {}
+
+		~WsArray() noexcept
+		{ delete[] items; }
+
+		T get(int64_t pos) const noexcept
+		{ return items[pos & (CAP - 1)].load(std::memory_order_relaxed); }
+
+		void put(int64_t pos, const T& item) noexcept
+		{ items[pos & (CAP - 1)].store(item, std::memory_order_relaxed); }
+	};
+
+
+	template<typename T>
+	class ws_deque {
+		static_assert(std::is_trivially_copyable<T>::value, "ws_deque stores trivially copyable items");
+	public:
+		typedef T                                       value;
+		typedef WsArray<T>                              Array;
+		typedef ws_deque<T>                             this_type;
+	public:
+		ws_deque                      (size_t capacity = 64);
+
+		~ws_deque                     ()                                     noexcept;
+
+		void push                     (const T& item);
+		bool pop                      (T& item)                              noexcept;
+		bool steal                    (T& item)                              noexcept;
+
+		bool empty                    ()const                                noexcept;
+
+		size_t size                   ()const                                noexcept;
+		size_t capacity               ()const                                noexcept;
+
+		ws_deque                      (const this_type& other)               = delete;
+		this_type& operator=          (const this_type& other)               = delete;
+	private:
+		Array* grow                   (Array* old, int64_t bottom,
+                                       int64_t top);
+	private:
+		alignas(64) std::atomic<int64_t> TOP;
+		alignas(64) std::atomic<int64_t> BOTTOM;
+		std::atomic<Array*>              array;
+		vector<Array*>                   retired;
+	};
+
+
+	template<typename T>
+	inline ws_deque<T>::ws_deque(size_t capacity) {
+		size_t rounded = 2;
+		while (rounded < capacity) {
+			rounded <<= 1;
+		}
+
+		TOP.store(0, std::memory_order_relaxed);
+		BOTTOM.store(0, std::memory_order_relaxed);
+		array.store(new Array((int64_t)rounded), std::memory_order_relaxed);
+	}
+
+
+	template<typename T>
+	inline ws_deque<T>::~ws_deque() noexcept {
+		delete array.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < retired.size(); ++i) {
+			delete retired.data()[i];
+		}
+	}
+
+
+	template<typename T>
+	inline void ws_deque<T>::push(const T& item) {
+		int64_t bottom = BOTTOM.load(std::memory_order_relaxed);
+		int64_t top = TOP.load(std::memory_order_acquire);
+		Array* current = array.load(std::memory_order_relaxed);
+
+		if (bottom - top > current->CAP - 1) {
+			current = grow(current, bottom, top);
+		}
+
+		current->put(bottom, item);
+		BOTTOM.store(bottom + 1, std::memory_order_release);
+	}
+
+
+	template<typename T>
+	inline bool ws_deque<T>::pop(T& item) noexcept {
+		int64_t bottom = BOTTOM.load(std::memory_order_relaxed) - 1;
+		Array* current = array.load(std::memory_order_relaxed);
+		BOTTOM.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = TOP.load(std::memory_order_relaxed);
+
+		if (top > bottom) {
+			BOTTOM.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		item = current->get(bottom);
+		if (top == bottom) {
+			bool won = TOP.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			BOTTOM.store(bottom + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+
+	template<typename T>
+	inline bool ws_deque<T>::steal(T& item) noexcept {
+		int64_t top = TOP.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = BOTTOM.load(std::memory_order_acquire);
+
+		if (top >= bottom) {
+			return false;
+		}
+
+		Array* current = array.load(std::memory_order_acquire);
+		T stolen = current->get(top);
+		if (!TOP.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return false;
+		}
+		item = stolen;
+		return true;
+	}
+
+
+	template<typename T>
+	inline bool ws_deque<T>::empty() const noexcept {
+		return size() == 0;
+	}
+
+
+	template<typename T>
+	inline size_t ws_deque<T>::size() const noexcept {
+		int64_t bottom = BOTTOM.load(std::memory_order_relaxed);
+		int64_t top = TOP.load(std::memory_order_relaxed);
+		return bottom > top ? (size_t)(bottom - top) : 0;
+	}
+
+
+	template<typename T>
+	inline size_t ws_deque<T>::capacity() const noexcept {
+		return (size_t)array.load(std::memory_order_relaxed)->CAP;
+	}
+
+
+	template<typename T>
+	inline typename ws_deque<T>::Array* ws_deque<T>::grow(Array* old, int64_t bottom, int64_t top) {
+		Array* bigger = new Array(old->CAP * 2);
+		for (int64_t pos = top; pos < bottom; ++pos) {
+			bigger->put(pos, old->get(pos));
+		}
+		retired.push_back(old);
+		array.store(bigger, std::memory_order_release);
+		return bigger;
+	}
+
+
+}
\ No newline at end of file